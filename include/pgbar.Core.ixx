@@ -1,8 +1,10 @@
 module;
 
 #include "pgbar/Indicator.hpp"
+#include "pgbar/Parallel.hpp"
 #include "pgbar/exception/Error.hpp"
 #include "pgbar/option/Option.hpp"
+#include "pgbar/sink/Sink.hpp"
 #include "pgbar/slice/BoundedSpan.hpp"
 #include "pgbar/slice/IteratorSpan.hpp"
 #include "pgbar/slice/NumericSpan.hpp"
@@ -51,12 +53,31 @@ export namespace pgbar {
 
   namespace config {
     using pgbar::config::auto_style_off;
+    using pgbar::config::backpressure;
+    using pgbar::config::damage_tracking;
+    using pgbar::config::enabled;
     using pgbar::config::hide_completed;
     using pgbar::config::intty;
+    using pgbar::config::log_interval;
+    using pgbar::config::log_milestone;
+    using pgbar::config::refresh_bounds;
     using pgbar::config::refresh_interval;
+    using pgbar::config::signal_interval;
+    using pgbar::config::sink;
     using pgbar::config::terminal_width;
+    using pgbar::config::writer_thread;
   } // namespace config
 
+  namespace sink {
+    using pgbar::sink::CallbackSink;
+    using pgbar::sink::CaptureSink;
+#if PGBAR__WIN || PGBAR__UNIX
+    using pgbar::sink::FdSink;
+#endif
+    using pgbar::sink::MemorySink;
+    using pgbar::sink::Sink;
+  }
+
   namespace slice {
     using pgbar::slice::BoundedSpan;
     using pgbar::slice::IteratorSpan;
@@ -72,4 +93,6 @@ export namespace pgbar {
 
   using pgbar::Indicator;
   using pgbar::iterate;
+  using pgbar::parallel_for;
+  using pgbar::poll;
 } // namespace pgbar
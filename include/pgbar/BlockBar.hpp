@@ -14,20 +14,21 @@ namespace pgbar {
       class BlockIndic : public Base {
       protected:
         PGBAR__CXX23_CNSTXPR io::CharPipeline& build_block( io::CharPipeline& buffer,
+                                                            std::uint16_t bar_width,
                                                             types::Float num_percent ) const
         {
           PGBAR__TRUST( num_percent >= 0.0 );
           PGBAR__TRUST( num_percent <= 1.0 );
-          if ( this->bar_width_ == 0 )
+          if ( bar_width == 0 )
             return buffer;
 
-          const auto len_finished     = static_cast<types::Size>( this->bar_width_ * num_percent );
-          const types::Float fraction = ( this->bar_width_ * num_percent ) - len_finished;
+          const auto len_finished     = static_cast<types::Size>( bar_width * num_percent );
+          const types::Float fraction = ( bar_width * num_percent ) - len_finished;
           PGBAR__TRUST( fraction >= 0.0 );
           PGBAR__TRUST( fraction <= 1.0 );
           const auto incomplete_block = static_cast<types::Size>( fraction * this->lead_.size() );
           PGBAR__ASSERT( incomplete_block <= this->lead_.size() );
-          types::Size len_vacancy = this->bar_width_ - len_finished;
+          types::Size len_vacancy = bar_width - len_finished;
 
           this->try_reset( buffer );
           this->try_dye( buffer, this->start_col_ ) << this->starting_;
@@ -38,7 +39,7 @@ namespace pgbar {
               .append( this->filler_, len_finished / this->filler_.width() )
               .append( ' ', len_finished % this->filler_.width() );
 
-            if ( this->bar_width_ != len_finished && !this->lead_.empty()
+            if ( bar_width != len_finished && !this->lead_.empty()
                  && this->lead_[incomplete_block].width() <= len_vacancy ) {
               this->try_reset( buffer );
               this->try_dye( buffer, this->lead_col_ ).append( this->lead_[incomplete_block] );
@@ -50,7 +51,7 @@ namespace pgbar {
               .append( ' ', len_vacancy % this->remains_.width() )
               .append( this->remains_, len_vacancy / this->remains_.width() );
           } else {
-            const auto flag = this->bar_width_ != len_finished && !this->lead_.empty()
+            const auto flag = bar_width != len_finished && !this->lead_.empty()
                            && this->lead_[incomplete_block].width() <= len_vacancy;
             if ( flag )
               len_vacancy -= this->lead_[incomplete_block].width();
@@ -150,6 +151,10 @@ namespace pgbar {
                    ? this->fixed_len_bar()
                    : 0 );
       }
+      PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t animation_resolution() const noexcept
+      {
+        return this->bar_width_ * ( this->lead_.empty() ? 1 : this->lead_.size() );
+      }
 
     public:
       using Base::Base;
@@ -175,9 +180,10 @@ namespace pgbar {
 
       protected:
         PGBAR__FORCEINLINE io::CharPipeline& build_animation( io::CharPipeline& buffer,
+                                                              std::uint16_t bar_width,
                                                               types::Float num_percent ) const
         {
-          return this->build_block( buffer, num_percent );
+          return this->build_block( buffer, bar_width, num_percent );
         }
 
       public:
@@ -185,6 +191,7 @@ namespace pgbar {
 
         PGBAR__FORCEINLINE io::CharPipeline& build(
           io::CharPipeline& buffer,
+          std::uint16_t num_columns,
           std::uint64_t num_task_done,
           std::uint64_t num_all_tasks,
           const std::chrono::steady_clock::time_point& zero_point ) const
@@ -192,9 +199,14 @@ namespace pgbar {
           PGBAR__TRUST( num_task_done <= num_all_tasks );
           const auto num_percent = static_cast<types::Float>( num_task_done ) / num_all_tasks;
 
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
-          return this
-            ->indirect_build( buffer, num_task_done, num_all_tasks, num_percent, zero_point, num_percent );
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          return this->indirect_build( buffer,
+                                       num_columns,
+                                       num_task_done,
+                                       num_all_tasks,
+                                       num_percent,
+                                       zero_point,
+                                       num_percent );
         }
       };
     } // namespace render
@@ -14,9 +14,10 @@ namespace pgbar {
       class FlowIndic : public Base {
       protected:
         PGBAR__CXX23_CNSTXPR io::CharPipeline& build_flow( io::CharPipeline& buffer,
+                                                           std::uint16_t bar_width,
                                                            std::uint32_t num_frame_cnt ) const
         {
-          if ( this->bar_width_ == 0 )
+          if ( bar_width == 0 )
             return buffer;
 
           num_frame_cnt = static_cast<std::uint64_t>( num_frame_cnt * this->shift_factor_ );
@@ -26,13 +27,13 @@ namespace pgbar {
 
           if ( !this->lead_.empty() ) {
             const auto& current_lead = this->lead_[num_frame_cnt % this->lead_.size()];
-            if ( current_lead.width() <= this->bar_width_ ) {
-              // virtual_point is a value between 0 and this->bar_width - 1
-              const auto virtual_point = [this, num_frame_cnt]() noexcept {
-                const auto pos = num_frame_cnt % this->bar_width_;
-                return !this->reversed_ ? pos : ( this->bar_width_ - 1 - pos ) % this->bar_width_;
+            if ( current_lead.width() <= bar_width ) {
+              // virtual_point is a value between 0 and bar_width - 1
+              const auto virtual_point = [this, bar_width, num_frame_cnt]() noexcept {
+                const auto pos = num_frame_cnt % bar_width;
+                return !this->reversed_ ? pos : ( bar_width - 1 - pos ) % bar_width;
               }();
-              const auto len_vacancy = this->bar_width_ - virtual_point;
+              const auto len_vacancy = bar_width - virtual_point;
 
               if ( current_lead.width() <= len_vacancy ) {
                 const auto len_right_fill = len_vacancy - current_lead.width();
@@ -70,14 +71,14 @@ namespace pgbar {
                   .append( ' ', len_vacancy - left_part.width() );
               }
             } else
-              buffer.append( ' ', this->bar_width_ );
+              buffer.append( ' ', bar_width );
           } else if ( this->filler_.empty() )
-            buffer.append( ' ', this->bar_width_ );
+            buffer.append( ' ', bar_width );
           else {
             this->try_reset( buffer );
             this->try_dye( buffer, this->filler_col_ );
-            buffer.append( this->filler_, this->bar_width_ / this->filler_.width() )
-              .append( ' ', this->bar_width_ % this->filler_.width() );
+            buffer.append( this->filler_, bar_width / this->filler_.width() )
+              .append( ' ', bar_width % this->filler_.width() );
           }
 
           this->try_reset( buffer );
@@ -150,6 +151,10 @@ namespace pgbar {
                    ? this->fixed_len_bar()
                    : 0 );
       }
+      PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t animation_resolution() const noexcept
+      {
+        return 0; // the animation moves with every frame rather than with the progress
+      }
 
     public:
       using Base::Base;
@@ -175,9 +180,10 @@ namespace pgbar {
 
       protected:
         PGBAR__FORCEINLINE io::CharPipeline& build_animation( io::CharPipeline& buffer,
+                                                              std::uint16_t bar_width,
                                                               std::uint64_t num_frame_cnt ) const
         {
-          return this->build_flow( buffer, num_frame_cnt );
+          return this->build_flow( buffer, bar_width, num_frame_cnt );
         }
 
       public:
@@ -185,6 +191,7 @@ namespace pgbar {
 
         PGBAR__FORCEINLINE io::CharPipeline& build(
           io::CharPipeline& buffer,
+          std::uint16_t num_columns,
           std::uint64_t num_frame_cnt,
           std::uint64_t num_task_done,
           std::uint64_t num_all_tasks,
@@ -193,9 +200,14 @@ namespace pgbar {
           PGBAR__TRUST( num_task_done <= num_all_tasks );
           const auto num_percent = static_cast<types::Float>( num_task_done ) / num_all_tasks;
 
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
-          return this
-            ->indirect_build( buffer, num_task_done, num_all_tasks, num_percent, zero_point, num_frame_cnt );
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          return this->indirect_build( buffer,
+                                       num_columns,
+                                       num_task_done,
+                                       num_all_tasks,
+                                       num_percent,
+                                       zero_point,
+                                       num_frame_cnt );
         }
       };
     } // namespace render
@@ -3,7 +3,13 @@
 
 #include "details/concurrent/Util.hpp"
 #include "details/console/TermContext.hpp"
+#include "details/io/OStream.hpp"
 #include "details/render/Renderer.hpp"
+#include "exception/Error.hpp"
+#include "sink/Sink.hpp"
+#include <algorithm>
+#include <memory>
+#include <utility>
 
 namespace pgbar {
   namespace config {
@@ -11,16 +17,21 @@ namespace pgbar {
     PGBAR__NODISCARD bool hide_completed() noexcept;
     void auto_style_off( bool flag ) noexcept;
     PGBAR__NODISCARD bool auto_style_off() noexcept;
+    void enabled( bool flag ) noexcept;
+    PGBAR__NODISCARD bool enabled() noexcept;
   }
 
   class Indicator {
     static std::atomic<bool> _hide_completed;
     static std::atomic<bool> _auto_style_off;
+    static std::atomic<bool> _enabled;
 
     friend void config::hide_completed( bool ) noexcept;
     friend bool config::hide_completed() noexcept;
     friend void config::auto_style_off( bool ) noexcept;
     friend bool config::auto_style_off() noexcept;
+    friend void config::enabled( bool ) noexcept;
+    friend bool config::enabled() noexcept;
 
   public:
     Indicator()                                = default;
@@ -49,6 +60,7 @@ namespace pgbar {
   };
   PGBAR__CXX17_INLINE std::atomic<bool> Indicator::_hide_completed { false };
   PGBAR__CXX17_INLINE std::atomic<bool> Indicator::_auto_style_off { true };
+  PGBAR__CXX17_INLINE std::atomic<bool> Indicator::_enabled { true };
 
   namespace config {
     inline void hide_completed( bool flag ) noexcept
@@ -71,6 +83,25 @@ namespace pgbar {
     {
       return Indicator::_auto_style_off.load( std::memory_order_relaxed );
     }
+    /**
+     * Whether the bars do anything at all.
+     * When disabled, `tick()` and its variants return at once, so no bar will be activated
+     * and no renderer thread will be launched; bars that are already active simply stop advancing.
+     *
+     * Always returns false if defined `PGBAR_DISABLE`, in which case the calls are optimized away.
+     */
+    inline void enabled( bool flag ) noexcept
+    {
+      Indicator::_enabled.store( flag, std::memory_order_relaxed );
+    }
+    PGBAR__NODISCARD inline bool enabled() noexcept
+    {
+#ifdef PGBAR_DISABLE
+      return false;
+#else
+      return Indicator::_enabled.load( std::memory_order_relaxed );
+#endif
+    }
 
     /**
      * Determine if the output stream is binded to the tty based on the platform api.
@@ -110,7 +141,255 @@ namespace pgbar {
       _details::render::Renderer<Channel::Stderr>::working_interval( new_rate );
       _details::render::Renderer<Channel::Stdout>::working_interval( new_rate );
     }
+
+    // Get the minimum interval between two frames rendered by `Policy::Signal`.
+    template<Channel Outlet>
+    PGBAR__NODISCARD TimeGranule signal_interval() noexcept
+    {
+      return _details::render::Renderer<Outlet>::signal_interval();
+    }
+    /**
+     * Set the minimum interval between two frames rendered by `Policy::Signal`.
+     * Requests that arrive within the interval are merged into a single frame; the default is zero.
+     */
+    template<Channel Outlet>
+    void signal_interval( TimeGranule new_rate ) noexcept
+    {
+      _details::render::Renderer<Outlet>::signal_interval( new_rate );
+    }
+    // Set every channels to the same minimum interval.
+    inline void signal_interval( TimeGranule new_rate ) noexcept
+    {
+      _details::render::Renderer<Channel::Stderr>::signal_interval( new_rate );
+      _details::render::Renderer<Channel::Stdout>::signal_interval( new_rate );
+    }
+
+    // Get the bounds within which the output interval is adapted, an upper bound of zero means it's not.
+    template<Channel Outlet>
+    PGBAR__NODISCARD std::pair<TimeGranule, TimeGranule> refresh_bounds() noexcept
+    {
+      return _details::render::Renderer<Outlet>::interval_bounds();
+    }
+    /**
+     * Let the render thread adapt the output interval to the measured cost of building and writing a frame
+     * within [lower, upper].
+     * The interval is stretched when rendering becomes expensive, e.g. over a slow remote session,
+     * shrunk back towards `refresh_interval()` when it's cheap again, and kept at `upper`
+     * when the channel isn't bound to a terminal.
+     * An `upper` of zero disables the adaptation, which is the default.
+
+     * Throw exception::InvalidArgument if `lower` is greater than `upper`.
+     */
+    template<Channel Outlet>
+    void refresh_bounds( TimeGranule lower, TimeGranule upper ) noexcept( false )
+    {
+      if ( lower > upper )
+        PGBAR__UNLIKELY throw exception::InvalidArgument(
+          _details::charcodes::make_literal( "pgbar: the lower bound is greater than the upper bound" ) );
+      _details::render::Renderer<Outlet>::interval_bounds( lower, upper );
+    }
+    // Set every channels to the same bounds.
+    inline void refresh_bounds( TimeGranule lower, TimeGranule upper ) noexcept( false )
+    {
+      refresh_bounds<Channel::Stderr>( lower, upper );
+      refresh_bounds<Channel::Stdout>( lower, upper );
+    }
+
+    // Get the interval between two routine lines written to a channel that isn't bound to a terminal.
+    template<Channel Outlet>
+    PGBAR__NODISCARD TimeGranule log_interval() noexcept
+    {
+      return _details::render::Renderer<Outlet>::log_interval();
+    }
+    /**
+     * When the channel isn't bound to a terminal, e.g. it's redirected to a log file,
+     * the progress is written as plain lines, and a line is only written when this interval has elapsed
+     * or a milestone is reached; the start and the end of the task are always written.
+     * The default is 10 seconds, and zero disables the time condition.
+     */
+    template<Channel Outlet>
+    void log_interval( TimeGranule new_rate ) noexcept
+    {
+      _details::render::Renderer<Outlet>::log_interval( new_rate );
+    }
+    // Set every channels to the same interval.
+    inline void log_interval( TimeGranule new_rate ) noexcept
+    {
+      _details::render::Renderer<Channel::Stderr>::log_interval( new_rate );
+      _details::render::Renderer<Channel::Stdout>::log_interval( new_rate );
+    }
+
+    // Get the percentage between two milestones written to a channel that isn't bound to a terminal.
+    template<Channel Outlet>
+    PGBAR__NODISCARD std::uint8_t log_milestone() noexcept
+    {
+      return _details::render::Renderer<Outlet>::log_milestone();
+    }
+    /**
+     * Write a line to a channel that isn't bound to a terminal whenever the progress crosses
+     * a multiple of `percentage`; the default is 10, and zero disables the milestones.
+     * Milestones only apply to the standalone progress bars,
+     * `MultiBar` and `DynamicBar` follow the time alone.
+
+     * If both this and `log_interval()` are zero, every frame is written as before.
+     */
+    template<Channel Outlet>
+    void log_milestone( std::uint8_t percentage ) noexcept
+    {
+      _details::render::Renderer<Outlet>::log_milestone( percentage );
+    }
+    // Set every channels to the same milestones.
+    inline void log_milestone( std::uint8_t percentage ) noexcept
+    {
+      _details::render::Renderer<Channel::Stderr>::log_milestone( percentage );
+      _details::render::Renderer<Channel::Stdout>::log_milestone( percentage );
+    }
+
+    // Whether only the changed cells of each frame are written to the terminal bound to the channel.
+    template<Channel Outlet>
+    PGBAR__NODISCARD bool damage_tracking() noexcept
+    {
+      return _details::io::OStream<Outlet>::damage_tracking();
+    }
+    /**
+     * When enabled, which is the default, each frame written to a terminal is compared with the previous one,
+     * and only the cells that have changed are rewritten; a full frame is still written every so often.
+     * Disable it if the terminal doesn't support moving the cursor to a column.
+     */
+    template<Channel Outlet>
+    void damage_tracking( bool flag ) noexcept
+    {
+      _details::io::OStream<Outlet>::damage_tracking( flag );
+    }
+    // Set every channels to the same state.
+    inline void damage_tracking( bool flag ) noexcept
+    {
+      _details::io::OStream<Channel::Stderr>::damage_tracking( flag );
+      _details::io::OStream<Channel::Stdout>::damage_tracking( flag );
+    }
+
+    // Whether the frames that a slow sink hasn't taken yet are dropped in favor of the newer ones.
+    template<Channel Outlet>
+    PGBAR__NODISCARD bool backpressure() noexcept
+    {
+      return _details::io::OStream<Outlet>::backpressure();
+    }
+    /**
+     * When enabled, a frame is held back while the sink hasn't taken what was written before,
+     * and it's dropped if a newer frame arrives in the meantime; the last frame is always written.
+     * Otherwise, which is the default, the frames written to a file or a pipe are all kept.
+     */
+    template<Channel Outlet>
+    void backpressure( bool flag ) noexcept
+    {
+      _details::io::OStream<Outlet>::backpressure( flag );
+    }
+    // Set every channels to the same state.
+    inline void backpressure( bool flag ) noexcept
+    {
+      _details::io::OStream<Channel::Stderr>::backpressure( flag );
+      _details::io::OStream<Channel::Stdout>::backpressure( flag );
+    }
+
+    // Whether the frames of the `Sync` and `Throttle` progress bars are written by a background thread.
+    template<Channel Outlet>
+    PGBAR__NODISCARD bool writer_thread() noexcept
+    {
+      return _details::io::OStream<Outlet>::writer_thread();
+    }
+    /**
+     * The frames of the `Async` and `Signal` progress bars are always written by a background thread,
+     * and those of the `External` ones never are. The `Sync` and `Throttle` progress bars also hand
+     * their frames over to the background thread by default, so a slow sink doesn't hold up the caller;
+     * when disabled, they write on the thread that renders the frame instead.
+     * It takes effect when the next progress bar starts.
+     */
+    template<Channel Outlet>
+    void writer_thread( bool flag ) noexcept
+    {
+      _details::io::OStream<Outlet>::writer_thread( flag );
+    }
+    // Set every channels to the same state.
+    inline void writer_thread( bool flag ) noexcept
+    {
+      _details::io::OStream<Channel::Stderr>::writer_thread( flag );
+      _details::io::OStream<Channel::Stdout>::writer_thread( flag );
+    }
+
+    // Get whether the width of the terminal is read again as soon as it's resized.
+    template<Channel Outlet>
+    PGBAR__NODISCARD bool track_resize() noexcept
+    {
+      return _details::console::TermContext<Outlet>::itself().track_resize();
+    }
+    /**
+     * The width of a terminal is read again at most every 250 milliseconds by default.
+     * When enabled on unix-like platforms, a `SIGWINCH` handler is installed for the process instead,
+     * which calls the handler installed before it, and the width is read again only after a resize;
+     * disabling it puts the previous handler back, as long as no handler has been installed after it.
+     * Defining `PGBAR_NOWINCH` makes this a no-op.
+     */
+    template<Channel Outlet>
+    void track_resize( bool flag ) noexcept
+    {
+      _details::console::TermContext<Outlet>::itself().track_resize( flag );
+    }
+    // Set every channels to the same state; the handlers are removed in the reverse order of installation.
+    inline void track_resize( bool flag ) noexcept
+    {
+      if ( flag ) {
+        _details::console::TermContext<Channel::Stderr>::itself().track_resize( true );
+        _details::console::TermContext<Channel::Stdout>::itself().track_resize( true );
+      } else {
+        _details::console::TermContext<Channel::Stdout>::itself().track_resize( false );
+        _details::console::TermContext<Channel::Stderr>::itself().track_resize( false );
+      }
+    }
+
+    // Get the sink that the channel writes to, or null if it writes to the standard stream.
+    template<Channel Outlet>
+    PGBAR__NODISCARD std::shared_ptr<pgbar::sink::Sink> sink() noexcept
+    {
+      return _details::console::TermContext<Outlet>::itself().sink();
+    }
+    /**
+     * Write the output of the channel to `target` instead of `stdout` or `stderr`,
+     * and a null `target` restores the standard stream.
+     *
+     * Whether the channel is a terminal follows `target->tty()` from now on.
+     * It's recommended to switch this before any bar on the channel starts.
+     */
+    template<Channel Outlet>
+    void sink( std::shared_ptr<pgbar::sink::Sink> target ) noexcept
+    {
+      _details::console::TermContext<Outlet>::itself().redirect( std::move( target ) );
+    }
+    // Set every channels to the same sink, which has to be safe to write from two threads.
+    inline void sink( const std::shared_ptr<pgbar::sink::Sink>& target ) noexcept
+    {
+      _details::console::TermContext<Channel::Stderr>::itself().redirect( target );
+      _details::console::TermContext<Channel::Stdout>::itself().redirect( target );
+    }
   } // namespace config
+
+  /**
+   * Render the progress bar running with `Policy::External` on the given channel, if a frame is due.
+   * Any exception thrown by the rendering is propagated to the caller.
+   *
+   * Return the time left until the next frame is due, which can be used as the timeout of an event loop;
+   * or `TimeGranule::max()` if there's no such progress bar running.
+   */
+  template<Channel Outlet>
+  TimeGranule poll() noexcept( false )
+  {
+    return _details::render::Renderer<Outlet>::itself().poll();
+  }
+  // Poll both channels, and return the earlier deadline of them.
+  inline TimeGranule poll() noexcept( false )
+  {
+    const auto stderr_deadline = poll<Channel::Stderr>();
+    return (std::min)( stderr_deadline, poll<Channel::Stdout>() );
+  }
 } // namespace pgbar
 
 #endif
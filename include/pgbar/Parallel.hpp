@@ -0,0 +1,126 @@
+#ifndef PGBAR_PARALLEL
+#define PGBAR_PARALLEL
+
+#include "details/concurrent/ExceptionBox.hpp"
+#include "details/concurrent/TaskSplitter.hpp"
+#include "slice/BoundedSpan.hpp"
+#include "slice/IteratorSpan.hpp"
+#include "slice/NumericSpan.hpp"
+#include "slice/TrackedSpan.hpp"
+#include <thread>
+#include <vector>
+
+namespace pgbar {
+  namespace _details {
+    namespace traits {
+      template<typename I>
+      using is_random_access_iterator = std::is_base_of<std::random_access_iterator_tag, IterCategory_t<I>>;
+
+      // Whether the span can be split into sub-intervals that are accessed by index in constant time.
+      template<typename S>
+      struct is_splittable_span : std::false_type {};
+      template<typename N>
+      struct is_splittable_span<slice::NumericSpan<N>> : std::true_type {};
+      template<typename Itr, typename Snt>
+      struct is_splittable_span<slice::IteratorSpan<Itr, Snt>> : is_random_access_iterator<Itr> {};
+      template<typename R>
+      struct is_splittable_span<slice::BoundedSpan<R>> : is_random_access_iterator<IteratorOf_t<R>> {};
+    } // namespace traits
+  } // namespace _details
+
+  /**
+   * Apply `fn` to every element of `span` on `num_threads` threads, the calling thread included,
+   * and tick `bar` as the elements are processed.
+
+   * The span is split among the threads, and the threads that run out of elements steal from the others;
+   * each thread ticks the bar once per chunk, so the bar's counter is rarely touched.
+   * `fn` is invoked concurrently, and a `num_threads` of zero means `std::thread::hardware_concurrency()`.
+
+   * If `fn` throws, the remaining elements are skipped, the bar is aborted,
+   * and the earliest exception is rethrown once every thread has stopped.
+   */
+  template<typename Bar, typename Span, typename Fn>
+  auto parallel_for( Bar& bar, Span span, Fn&& fn, _details::types::Size num_threads = 0 )
+#ifdef __cpp_concepts
+    requires( _details::traits::is_iterable_bar<Bar>::value
+              && _details::traits::is_splittable_span<Span>::value )
+#else
+    -> typename std::enable_if<_details::traits::AllOf<_details::traits::is_iterable_bar<Bar>,
+                                                       _details::traits::is_splittable_span<Span>>::value>::type
+#endif
+  {
+    if ( bar.active() )
+      PGBAR__UNLIKELY throw exception::InvalidState(
+        _details::charcodes::make_literal( "pgbar: try to iterate using an active object" ) );
+    const auto total = static_cast<std::uint64_t>( span.size() );
+    bar.config().tasks( total );
+    if ( total == 0 )
+      return;
+
+    if ( num_threads == 0 )
+      num_threads = (std::max)( std::thread::hardware_concurrency(), 1u );
+    num_threads = static_cast<_details::types::Size>(
+      (std::min)( static_cast<std::uint64_t>( num_threads ), total ) );
+    // Small enough for the stealing to balance the load, large enough to keep the bar out of the way.
+    const auto grain = (std::max)( total / ( num_threads * 64 ), static_cast<std::uint64_t>( 1 ) );
+
+    _details::concurrent::TaskSplitter splitter { num_threads, total, grain };
+    _details::concurrent::ExceptionBox box;
+    const auto startpoint = span.begin();
+    using Difference      = _details::traits::IterDifference_t<decltype( span.begin() )>;
+
+    auto worker = [&]( _details::types::Size id ) noexcept {
+      try {
+        for ( std::uint64_t first, last; splitter.next( id, first, last ); ) {
+          for ( auto i = first; i < last; ++i )
+            (void)fn( startpoint[static_cast<Difference>( i )] );
+          bar.tick( last - first );
+        }
+      } catch ( ... ) {
+        splitter.cancel();
+        const auto stored = box.try_store( std::current_exception() );
+        (void)stored; // only the earliest exception is kept
+      }
+    };
+
+    std::vector<std::thread> threads;
+    try {
+      threads.reserve( num_threads - 1 );
+      for ( _details::types::Size id = 1; id < num_threads; ++id )
+        threads.emplace_back( worker, id );
+    } catch ( ... ) {
+      splitter.cancel();
+      for ( auto& td : threads )
+        td.join();
+      throw;
+    }
+    worker( 0 );
+    for ( auto& td : threads )
+      td.join();
+
+    if ( !box.empty() ) {
+      bar.abort();
+      box.rethrow();
+    }
+  }
+  // Visualize a parallel traversal over the whole `container`.
+  template<typename Bar, typename R, typename Fn>
+  auto parallel_for( Bar& bar, R& container, Fn&& fn, _details::types::Size num_threads = 0 )
+#ifdef __cpp_concepts
+    requires( _details::traits::is_iterable_bar<Bar>::value
+              && !_details::traits::is_splittable_span<std::remove_cv_t<R>>::value
+              && _details::traits::is_bounded_range<R>::value && !std::ranges::view<R>
+              && _details::traits::is_random_access_iterator<_details::traits::IteratorOf_t<R>>::value )
+#else
+    -> typename std::enable_if<_details::traits::AllOf<
+      _details::traits::is_iterable_bar<Bar>,
+      _details::traits::Not<_details::traits::is_splittable_span<typename std::remove_cv<R>::type>>,
+      _details::traits::is_bounded_range<R>,
+      _details::traits::is_random_access_iterator<_details::traits::IteratorOf_t<R>>>::value>::type
+#endif
+  {
+    parallel_for( bar, slice::BoundedSpan<R>( container ), std::forward<Fn>( fn ), num_threads );
+  }
+} // namespace pgbar
+
+#endif
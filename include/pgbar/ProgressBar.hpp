@@ -14,16 +14,17 @@ namespace pgbar {
       class CharIndic : public Base {
       protected:
         PGBAR__CXX23_CNSTXPR io::CharPipeline& build_char( io::CharPipeline& buffer,
+                                                           std::uint16_t bar_width,
                                                            types::Float num_percent,
                                                            std::uint32_t num_frame_cnt ) const
         {
           PGBAR__TRUST( num_percent >= 0.0 );
           PGBAR__TRUST( num_percent <= 1.0 );
-          if ( this->bar_width_ == 0 )
+          if ( bar_width == 0 )
             return buffer;
 
-          const auto len_finished = static_cast<types::Size>( std::round( this->bar_width_ * num_percent ) );
-          types::Size len_vacancy = this->bar_width_ - len_finished;
+          const auto len_finished = static_cast<types::Size>( std::round( bar_width * num_percent ) );
+          types::Size len_vacancy = bar_width - len_finished;
 
           this->try_reset( buffer );
           this->try_dye( buffer, this->start_col_ ) << this->starting_;
@@ -153,6 +154,11 @@ namespace pgbar {
                    ? this->fixed_len_bar()
                    : 0 );
       }
+      PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t animation_resolution() const noexcept
+      {
+        // A multi-frame lead keeps moving with every frame.
+        return this->lead_.size() > 1 ? 0 : this->bar_width_;
+      }
 
     public:
       using Base::Base;
@@ -178,10 +184,11 @@ namespace pgbar {
 
       protected:
         PGBAR__FORCEINLINE io::CharPipeline& build_animation( io::CharPipeline& buffer,
+                                                              std::uint16_t bar_width,
                                                               types::Float num_percent,
                                                               std::uint64_t num_frame_cnt ) const
         {
-          return this->build_char( buffer, num_percent, num_frame_cnt );
+          return this->build_char( buffer, bar_width, num_percent, num_frame_cnt );
         }
 
       public:
@@ -189,6 +196,7 @@ namespace pgbar {
 
         PGBAR__FORCEINLINE io::CharPipeline& build(
           io::CharPipeline& buffer,
+          std::uint16_t num_columns,
           std::uint64_t num_frame_cnt,
           std::uint64_t num_task_done,
           std::uint64_t num_all_tasks,
@@ -197,8 +205,9 @@ namespace pgbar {
           PGBAR__TRUST( num_task_done <= num_all_tasks );
           const auto num_percent = static_cast<types::Float>( num_task_done ) / num_all_tasks;
 
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
           return this->indirect_build( buffer,
+                                       num_columns,
                                        num_task_done,
                                        num_all_tasks,
                                        num_percent,
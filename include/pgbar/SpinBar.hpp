@@ -23,9 +23,12 @@ namespace pgbar {
           num_frame_cnt %= this->lead_.size();
           PGBAR__ASSERT( this->len_longest_lead_ >= this->lead_[num_frame_cnt].width() );
 
+          const auto& lead = this->lead_[num_frame_cnt];
           this->try_reset( buffer );
+          // Pad by the width of the frame, which a frame of multi-byte glyphs doesn't have in bytes.
           return this->try_style( buffer, this->lead_col_ )
-              << utils::format<utils::TxtLayout::Left>( this->len_longest_lead_, this->lead_[num_frame_cnt] );
+                   .append( lead )
+                   .append( ' ', this->len_longest_lead_ - lead.width() );
         }
 
       public:
@@ -75,6 +78,10 @@ namespace pgbar {
                    ? this->fixed_len_frames()
                    : 0 );
       }
+      PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t animation_resolution() const noexcept
+      {
+        return 0; // the animation moves with every frame rather than with the progress
+      }
 
     public:
       using Base::Base;
@@ -97,54 +104,79 @@ namespace pgbar {
       private:
         using Self = config::Spin;
 
-      public:
-        using CommonBuilder<Self>::CommonBuilder;
-
-        io::CharPipeline& build( io::CharPipeline& buffer,
-                                 std::uint64_t num_frame_cnt,
-                                 std::uint64_t num_task_done,
-                                 std::uint64_t num_all_tasks,
-                                 const std::chrono::steady_clock::time_point& zero_point ) const
+        // If the line is wider than a terminal of `num_columns` columns, the postfix is cut until it fits in.
+        void compile( std::uint16_t num_columns ) const
         {
-          PGBAR__TRUST( num_task_done <= num_all_tasks );
-          const auto num_percent = static_cast<types::Float>( num_task_done ) / num_all_tasks;
+          auto& frame = this->frame_;
+          frame.reset( this->revision(), num_columns );
+
+          const bool divided =
+            !this->postfix_.empty() && ( !this->prefix_.empty() || this->visual_masks_.any() );
+          const auto num_cut = this->overflow( num_columns, [this, divided]() noexcept {
+            return this->fixed_render_size() + ( divided ? this->divider_.width() : 0 );
+          } );
 
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
           if ( !this->prefix_.empty() || !this->postfix_.empty() || this->visual_masks_.any() ) {
-            this->try_style( buffer, this->info_col_ );
-            buffer << this->l_border_;
+            this->try_style( frame, this->info_col_ );
+            frame << this->l_border_;
           }
 
-          this->build_prefix( buffer );
-          this->try_reset( buffer );
+          this->build_prefix( frame );
+          this->try_reset( frame );
           if ( this->visual_masks_[utils::to_underlying( Self::Mask::Ani )] ) {
-            this->build_spin( buffer, num_frame_cnt );
-            this->try_reset( buffer );
+            frame.slot( Slot::Animation );
+            this->try_reset( frame );
             auto masks = this->visual_masks_;
             if ( masks.reset( utils::to_underlying( Self::Mask::Ani ) ).any() ) {
-              this->try_style( buffer, this->info_col_ );
-              buffer << this->divider_;
+              this->try_style( frame, this->info_col_ );
+              frame << this->divider_;
             }
           }
           if ( this->visual_masks_[utils::to_underlying( Self::Mask::Per )] ) {
-            this->build_percent( buffer, num_percent );
+            frame.slot( Slot::Percent );
             auto masks = this->visual_masks_;
             if ( masks.reset( utils::to_underlying( Self::Mask::Ani ) )
                    .reset( utils::to_underlying( Self::Mask::Per ) )
                    .any() )
-              buffer << this->divider_;
+              frame << this->divider_;
           }
-          this->common_build( buffer, num_task_done, num_all_tasks, zero_point );
+          this->compile_common();
 
-          if ( !this->postfix_.empty() && ( !this->prefix_.empty() || this->visual_masks_.any() ) )
-            buffer << this->divider_;
-          this->build_postfix( buffer );
-          this->try_reset( buffer );
+          // The divider goes away with the postfix if it's cut off entirely.
+          if ( divided && ( num_cut == 0 || num_cut < this->postfix_.width() ) )
+            frame << this->divider_;
+          this->build_postfix( frame, num_cut );
+          this->try_reset( frame );
           if ( !this->prefix_.empty() || !this->postfix_.empty() || this->visual_masks_.any() ) {
-            this->try_style( buffer, this->info_col_ );
-            buffer << this->r_border_;
+            this->try_style( frame, this->info_col_ );
+            frame << this->r_border_;
           }
-          return this->try_reset( buffer );
+          this->try_reset( frame );
+          frame.seal();
+        }
+
+      public:
+        using CommonBuilder<Self>::CommonBuilder;
+
+        io::CharPipeline& build( io::CharPipeline& buffer,
+                                 std::uint16_t num_columns,
+                                 std::uint64_t num_frame_cnt,
+                                 std::uint64_t num_task_done,
+                                 std::uint64_t num_all_tasks,
+                                 const std::chrono::steady_clock::time_point& zero_point ) const
+        {
+          PGBAR__TRUST( num_task_done <= num_all_tasks );
+          const auto num_percent = static_cast<types::Float>( num_task_done ) / num_all_tasks;
+
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          if ( !this->frame_.compiled( this->revision(), num_columns ) )
+            PGBAR__UNLIKELY compile( num_columns );
+          return this->replay( buffer, num_task_done, num_all_tasks, zero_point, [&]( Slot slot ) {
+            if ( slot == Slot::Percent )
+              this->build_percent( buffer, num_percent );
+            else
+              this->build_spin( buffer, num_frame_cnt );
+          } );
         }
       };
     } // namespace render
@@ -14,9 +14,10 @@ namespace pgbar {
       class SweepIndic : public Base {
       protected:
         PGBAR__CXX20_CNSTXPR io::CharPipeline& build_sweep( io::CharPipeline& buffer,
+                                                            std::uint16_t bar_width,
                                                             std::uint32_t num_frame_cnt ) const
         {
-          if ( this->bar_width_ == 0 )
+          if ( bar_width == 0 )
             return buffer;
 
           num_frame_cnt = static_cast<std::uint64_t>( num_frame_cnt * this->shift_factor_ );
@@ -26,27 +27,28 @@ namespace pgbar {
 
           if ( !this->lead_.empty() ) {
             const auto& current_lead = this->lead_[num_frame_cnt % this->lead_.size()];
-            if ( current_lead.width() <= this->bar_width_ ) {
-              // virtual_point is a value between 1 and this->bar_width
-              const auto virtual_point = [this, num_frame_cnt]() noexcept -> std::uint64_t {
-                if ( this->bar_width_ == 1 )
+            if ( current_lead.width() <= bar_width ) {
+              // virtual_point is a value between 1 and bar_width
+              const auto virtual_point = [bar_width, num_frame_cnt]() noexcept -> std::uint64_t {
+                if ( bar_width == 1 )
                   return 1;
-                const auto period = 2 * this->bar_width_ - 2;
+                const auto period = 2 * bar_width - 2;
                 const auto pos    = num_frame_cnt % period;
-                return pos < this->bar_width_ ? pos + 1 : 2 * this->bar_width_ - pos - 1;
+                return pos < bar_width ? pos + 1 : 2 * bar_width - pos - 1;
               }();
-              const auto len_left_fill = [this, virtual_point, &current_lead]() noexcept -> std::uint64_t {
-                const auto len_half_lead = ( current_lead.width() / 2 ) + current_lead.width() % 2;
-                if ( virtual_point <= len_half_lead )
-                  return 0;
-                const auto len_unreached = this->bar_width_ - virtual_point;
-                if ( len_unreached <= len_half_lead - current_lead.width() % 2 )
-                  return this->bar_width_ - current_lead.width();
-
-                return virtual_point - len_half_lead;
-              }();
-              const auto len_right_fill = this->bar_width_ - ( len_left_fill + current_lead.width() );
-              PGBAR__ASSERT( len_left_fill + len_right_fill + current_lead.width() == this->bar_width_ );
+              const auto len_left_fill =
+                [bar_width, virtual_point, &current_lead]() noexcept -> std::uint64_t {
+                  const auto len_half_lead = ( current_lead.width() / 2 ) + current_lead.width() % 2;
+                  if ( virtual_point <= len_half_lead )
+                    return 0;
+                  const auto len_unreached = bar_width - virtual_point;
+                  if ( len_unreached <= len_half_lead - current_lead.width() % 2 )
+                    return bar_width - current_lead.width();
+
+                  return virtual_point - len_half_lead;
+                }();
+              const auto len_right_fill = bar_width - ( len_left_fill + current_lead.width() );
+              PGBAR__ASSERT( len_left_fill + len_right_fill + current_lead.width() == bar_width );
 
               this->try_reset( buffer );
               this->try_dye( buffer, this->filler_col_ )
@@ -61,14 +63,14 @@ namespace pgbar {
                 .append( ' ', len_right_fill % this->filler_.width() )
                 .append( this->filler_, len_right_fill / this->filler_.width() );
             } else
-              buffer.append( ' ', this->bar_width_ );
+              buffer.append( ' ', bar_width );
           } else if ( this->filler_.empty() )
-            buffer.append( ' ', this->bar_width_ );
+            buffer.append( ' ', bar_width );
           else {
             this->try_reset( buffer );
             this->try_dye( buffer, this->filler_col_ )
-              .append( this->filler_, this->bar_width_ / this->filler_.width() )
-              .append( ' ', this->bar_width_ % this->filler_.width() );
+              .append( this->filler_, bar_width / this->filler_.width() )
+              .append( ' ', bar_width % this->filler_.width() );
           }
 
           this->try_reset( buffer );
@@ -136,6 +138,10 @@ namespace pgbar {
                    ? this->fixed_len_bar()
                    : 0 );
       }
+      PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t animation_resolution() const noexcept
+      {
+        return 0; // the animation moves with every frame rather than with the progress
+      }
 
     public:
       using Base::Base;
@@ -161,9 +167,10 @@ namespace pgbar {
 
       protected:
         PGBAR__FORCEINLINE io::CharPipeline& build_animation( io::CharPipeline& buffer,
+                                                              std::uint16_t bar_width,
                                                               std::uint64_t num_frame_cnt ) const
         {
-          return this->build_sweep( buffer, num_frame_cnt );
+          return this->build_sweep( buffer, bar_width, num_frame_cnt );
         }
 
       public:
@@ -171,6 +178,7 @@ namespace pgbar {
 
         PGBAR__FORCEINLINE io::CharPipeline& build(
           io::CharPipeline& buffer,
+          std::uint16_t num_columns,
           std::uint64_t num_frame_cnt,
           std::uint64_t num_task_done,
           std::uint64_t num_all_tasks,
@@ -179,9 +187,14 @@ namespace pgbar {
           PGBAR__TRUST( num_task_done <= num_all_tasks );
           const auto num_percent = static_cast<types::Float>( num_task_done ) / num_all_tasks;
 
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
-          return this
-            ->indirect_build( buffer, num_task_done, num_all_tasks, num_percent, zero_point, num_frame_cnt );
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          return this->indirect_build( buffer,
+                                       num_columns,
+                                       num_task_done,
+                                       num_all_tasks,
+                                       num_percent,
+                                       zero_point,
+                                       num_frame_cnt );
         }
       };
     } // namespace render
@@ -5,6 +5,7 @@
 #include "../../slice/BoundedSpan.hpp"
 #include "../../slice/IteratorSpan.hpp"
 #include "../../slice/NumericSpan.hpp"
+#include "../concurrent/StripedCounter.hpp"
 #include "../io/OStream.hpp"
 #include "../prefabs/BasicConfig.hpp"
 #include "../render/Builder.hpp"
@@ -23,6 +24,13 @@ namespace pgbar {
 
   namespace _details {
     namespace assets {
+      // What a tick means for the rendering.
+      enum class Gate : std::uint8_t {
+        Hidden,  // nothing visible has changed
+        Probe,   // nothing visible has changed by the counter, but the configuration is due for a look
+        Visible, // the counter has moved by a visible step
+      };
+
       template<typename Base, typename Derived>
       class IterableBar : public Base {
         // Throws the exception::InvalidState if current object is active.
@@ -33,10 +41,190 @@ namespace pgbar {
               charcodes::make_literal( "pgbar: try to iterate using an active object" ) );
         }
 
+        // The configuration is looked at for a revision at least every `2^_probe_shift` ticks.
+        static constexpr std::uint8_t _probe_shift = 6;
+
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE std::uint8_t shift_of( std::uint64_t visible_stride )
+          noexcept
+        {
+          std::uint8_t shift = 0;
+          while ( visible_stride >>= 1 )
+            ++shift;
+          return shift;
+        }
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE std::uint64_t mask_of( std::uint8_t shift ) noexcept
+        {
+          return ( std::uint64_t( 1 ) << shift ) - 1;
+        }
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE std::uint8_t probe_shift_of( std::uint8_t shift ) noexcept
+        {
+          return shift < _probe_shift ? shift : std::uint8_t( _probe_shift );
+        }
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE std::int64_t stamp() noexcept
+        {
+          return std::chrono::duration_cast<TimeGranule>(
+                   std::chrono::steady_clock::now().time_since_epoch() )
+            .count();
+        }
+
       protected:
         std::atomic<std::uint64_t> task_cnt_;
         std::uint64_t task_end_;
 
+        /* When the bar is ticked by many threads at once, `task_cnt_` becomes a hotspot;
+         * so the increments are accumulated in per-thread stripes first
+         * and are folded into `task_cnt_` in batches. */
+        concurrent::StripedCounter stripes_;
+        bool striped_ = false;
+        /* A batch leaves its stripe before it reaches `task_cnt_`, so a striped count may briefly go back;
+         * the highest one ever reported keeps the progress from doing so. */
+        mutable std::atomic<std::uint64_t> reported_;
+        /* Rendering is only requested when the counter crosses a multiple of `2^commit_shift_`,
+         * as nothing visible changes in between; it never exceeds `stride_shift_`,
+         * which is derived from the configuration of revision `stride_revision_`.
+
+         * The shift is adjusted while the ticks go on, so it's read and written without ordering. */
+        std::atomic<std::uint8_t> commit_shift_;
+        std::atomic<std::uint8_t> stride_shift_;
+        std::atomic<std::uint64_t> stride_revision_;
+        /* If the frame has time-driven components that only the commits refresh,
+         * the shift is kept small enough for a commit to come about once per refresh interval. */
+        bool paced_ = false;
+        std::atomic<std::int64_t> last_commit_;
+
+        // Reset the counter, and decide whether the stripes are worth engaging for this round.
+        void reset_counter( bool stripable,
+                            bool paced,
+                            std::uint64_t visible_stride,
+                            std::uint64_t revision ) &
+        {
+          PGBAR__TRUST( visible_stride > 0 );
+          task_cnt_.store( 0, std::memory_order_release );
+          reported_.store( 0, std::memory_order_relaxed );
+          paced_ = paced;
+          stride_shift_.store( shift_of( visible_stride ), std::memory_order_relaxed );
+          commit_shift_.store( paced ? 0 : shift_of( visible_stride ), std::memory_order_relaxed );
+          stride_revision_.store( revision, std::memory_order_relaxed );
+          last_commit_.store( stamp(), std::memory_order_relaxed );
+          striped_ = false;
+          if ( !stripable )
+            return;
+          const auto num_slots = concurrent::StripedCounter::concurrency();
+          const auto stride    = task_end_ / ( num_slots * 256 );
+          if ( num_slots > 1 && stride >= 16 ) {
+            stripes_.engage( num_slots, stride );
+            striped_ = true;
+          }
+        }
+        /* Decide whether a tick that passed the gate `gate` is worth a rendering request.
+
+         * The stride is recomputed by `visible_stride` if the configuration is no longer of revision
+         * `revision`; and a paced counter adapts its shift to the time since the last commit. */
+        template<typename F>
+        PGBAR__NOINLINE bool review( Gate gate,
+                                     std::uint64_t revision,
+                                     TimeGranule interval,
+                                     F&& visible_stride ) noexcept
+        {
+          bool visible = gate == Gate::Visible;
+          auto seen    = stride_revision_.load( std::memory_order_relaxed );
+          if ( seen != revision
+               && stride_revision_.compare_exchange_strong( seen, revision, std::memory_order_relaxed ) ) {
+            const auto shift = shift_of( visible_stride() );
+            stride_shift_.store( shift, std::memory_order_relaxed );
+            const auto current = commit_shift_.load( std::memory_order_relaxed );
+            commit_shift_.store( paced_ && current < shift ? current : shift, std::memory_order_relaxed );
+            visible = true;
+          }
+          if ( !paced_ )
+            return visible;
+
+          const auto now = stamp();
+          const auto gap = TimeGranule( now - last_commit_.load( std::memory_order_relaxed ) );
+          if ( !visible && gap < interval )
+            return false;
+          last_commit_.store( now, std::memory_order_relaxed );
+          auto shift = commit_shift_.load( std::memory_order_relaxed );
+          if ( gap < interval / 2 && shift < stride_shift_.load( std::memory_order_relaxed ) )
+            ++shift;
+          else if ( gap > interval && shift > 0 )
+            --shift;
+          commit_shift_.store( shift, std::memory_order_relaxed );
+          return true;
+        }
+        // Return true if a tick that passed the gate `gate` is worth a rendering request.
+        template<typename F>
+        PGBAR__FORCEINLINE bool passes( Gate gate,
+                                        std::uint64_t revision,
+                                        TimeGranule interval,
+                                        F&& visible_stride ) noexcept
+        {
+          if ( gate == Gate::Hidden )
+            return false;
+          if ( gate == Gate::Visible && !paced_
+               && stride_revision_.load( std::memory_order_relaxed ) == revision )
+            return true;
+          return review( gate, revision, interval, std::forward<F>( visible_stride ) );
+        }
+        // Fold everything held by the stripes into `task_cnt_`, and stop striping for the rest of this round.
+        PGBAR__FORCEINLINE void fold_counter() noexcept
+        {
+          if ( striped_ )
+            task_cnt_.fetch_add( stripes_.disengage(), std::memory_order_seq_cst );
+        }
+        // Fold the stripes once the remaining tasks are few enough to be fully held by them,
+        // so that the final increment is always visible in `task_cnt_`.
+        PGBAR__FORCEINLINE void settle_counter() noexcept
+        {
+          if ( striped_
+               && task_cnt_.load( std::memory_order_acquire ) + stripes_.reserve() >= task_end_ )
+            PGBAR__UNLIKELY fold_counter();
+        }
+        /* Tell what the increment means for the rendering.
+
+         * The updates of `task_cnt_` are sequentially consistent, as a parked render thread
+         * is only woken up by a request that it can tell has come after its last look at the counter. */
+        PGBAR__FORCEINLINE Gate increase_counter() noexcept
+        {
+          // Once the stripes are disengaged, the increment goes straight to `task_cnt_`.
+          if ( !striped_ || !stripes_.engaged() ) {
+            const auto task_cnt = task_cnt_.fetch_add( 1, std::memory_order_seq_cst ) + 1;
+            const auto shift    = commit_shift_.load( std::memory_order_relaxed );
+            if ( ( task_cnt & mask_of( probe_shift_of( shift ) ) ) != 0 )
+              return Gate::Hidden;
+            return ( task_cnt & mask_of( shift ) ) == 0 ? Gate::Visible : Gate::Probe;
+          } else if ( const auto batch = stripes_.add() ) {
+            task_cnt_.fetch_add( batch, std::memory_order_seq_cst );
+            settle_counter();
+            return Gate::Visible;
+          }
+          return Gate::Hidden;
+        }
+        // Same as `increase_counter`, but the counter is increased by `num` and clamped to `task_end_`.
+        PGBAR__FORCEINLINE Gate advance_counter( std::uint64_t num ) noexcept
+        {
+          const auto task_cnt = current_counter();
+          num                 = task_cnt + num > task_end_ ? task_end_ - task_cnt : num;
+          const auto previous = task_cnt_.fetch_add( num, std::memory_order_seq_cst );
+          settle_counter();
+          const auto shift = commit_shift_.load( std::memory_order_relaxed );
+          if ( ( previous >> shift ) != ( ( previous + num ) >> shift ) )
+            return Gate::Visible;
+          const auto probe_shift = probe_shift_of( shift );
+          return ( previous >> probe_shift ) != ( ( previous + num ) >> probe_shift ) ? Gate::Probe
+                                                                                     : Gate::Hidden;
+        }
+        // The number of finished tasks, including those not yet folded into `task_cnt_`.
+        PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t current_counter() const noexcept
+        {
+          // The shared counter must be read first; otherwise a batch in flight may be counted twice.
+          const auto task_cnt = task_cnt_.load( std::memory_order_acquire );
+          if ( !striped_ )
+            return task_cnt;
+          const auto total = task_cnt + stripes_.pending();
+          return total > task_end_ ? task_end_ : total;
+        }
+
       public:
         template<
           typename... Args,
@@ -44,9 +232,21 @@ namespace pgbar {
             std::is_base_of<IterableBar<Base, Derived>, typename std::decay<Args>::type>...>>::value>::type>
         constexpr IterableBar( Args&&... args )
           noexcept( std::is_nothrow_constructible<Base, Args&&...>::value )
-          : Base( std::forward<Args>( args )... ), task_cnt_ { 0 }
+          : Base( std::forward<Args>( args )... )
+          , task_cnt_ { 0 }
+          , reported_ { 0 }
+          , commit_shift_ { 0 }
+          , stride_shift_ { 0 }
+          , stride_revision_ { 0 }
+          , last_commit_ { 0 }
         {}
-        IterableBar( IterableBar&& rhs ) noexcept : Base( std::move( rhs ) )
+        IterableBar( IterableBar&& rhs ) noexcept
+          : Base( std::move( rhs ) )
+          , reported_ { 0 }
+          , commit_shift_ { 0 }
+          , stride_shift_ { 0 }
+          , stride_revision_ { 0 }
+          , last_commit_ { 0 }
         {
           task_cnt_.store( 0, std::memory_order_relaxed );
         }
@@ -60,7 +260,13 @@ namespace pgbar {
         // Get the progress of the task.
         PGBAR__NODISCARD std::uint64_t progress() const noexcept
         {
-          return task_cnt_.load( std::memory_order_acquire );
+          const auto current = current_counter();
+          if ( !striped_ )
+            return current;
+          auto reported = reported_.load( std::memory_order_relaxed );
+          while ( reported < current
+                  && !reported_.compare_exchange_weak( reported, current, std::memory_order_relaxed ) ) {}
+          return reported < current ? current : reported;
         }
 
         /**
@@ -303,6 +509,41 @@ namespace pgbar {
         }
         friend PGBAR__FORCEINLINE void make_frame( CoreBar& self ) { self.make_frame(); }
 
+        // Return false if the next frame would look the same as the last refreshed one.
+        PGBAR__FORCEINLINE bool renew() & noexcept
+        {
+          if ( static_cast<Subcls*>( this )->categorize() != StateCategory::Refresh )
+            return true;
+          const auto generation  = static_cast<Subcls*>( this )->generation();
+          const auto revision    = config_.revision();
+          const auto num_columns = console::TermContext<Outlet>::itself().columns();
+          if ( generation.second != render::Builder<Soul>::_volatile_stamp
+               && generation.first == last_counter_ && generation.second == last_stamp_
+               && revision == last_revision_ && num_columns == last_columns_ )
+            return false;
+          last_counter_  = generation.first;
+          last_stamp_    = generation.second;
+          last_revision_ = revision;
+          last_columns_  = num_columns;
+          return true;
+        }
+        friend PGBAR__FORCEINLINE bool renew( CoreBar& self ) noexcept { return self.renew(); }
+        // Return true if the frame only changes when the bar is ticked or reconfigured.
+        PGBAR__FORCEINLINE bool still() const noexcept
+        {
+          return !static_cast<const Subcls*>( this )->time_driven();
+        }
+        friend PGBAR__FORCEINLINE bool still( const CoreBar& self ) noexcept { return self.still(); }
+        friend PGBAR__FORCEINLINE types::Size frame_capacity( const CoreBar& self ) noexcept
+        {
+          return self.config_.frame_capacity();
+        }
+        // The revision of the configuration that the last refreshed frame was built from.
+        friend PGBAR__FORCEINLINE std::uint64_t frame_revision( const CoreBar& self ) noexcept
+        {
+          return self.last_revision_;
+        }
+
       protected:
         enum class StateCategory : std::uint8_t { Stop, Awake, Refresh, Finish };
 
@@ -310,6 +551,15 @@ namespace pgbar {
         mutable std::mutex mtx_;
 
         std::chrono::steady_clock::time_point zero_point_;
+        // What the last refreshed frame was built from, only touched by the rendering.
+        std::uint64_t last_counter_ = 0, last_stamp_ = 0, last_revision_ = 0;
+        std::uint16_t last_columns_ = 0;
+
+        // Make the next refreshed frame be built whatever it looks like.
+        PGBAR__FORCEINLINE void forget_frame() & noexcept
+        {
+          last_stamp_ = render::Builder<Soul>::_volatile_stamp;
+        }
 
         // An extension point that performs global resource cleanup related to the progress bar semantics
         // themselves.
@@ -319,7 +569,7 @@ namespace pgbar {
           PGBAR__ASSERT( executor.empty() == false );
           if ( !forced )
             executor.template trigger<Mode>();
-          executor.dismiss_then( []() noexcept { io::OStream<Outlet>::itself().release(); } );
+          executor.dismiss_then( []() noexcept { io::OStream<Outlet>::itself().reset(); } );
         }
         virtual void do_boot() & noexcept( false )
         {
@@ -338,6 +588,19 @@ namespace pgbar {
                    ostream << io::flush;
                  } break;
                  case StateCategory::Refresh: {
+                   auto& renderer = render::Renderer<Outlet>::itself();
+                   if ( !istty && !renderer.admit( static_cast<Subcls*>( this )->ratio() ) )
+                     return;
+                   // Neither the build nor the write is needed if the frame would look the same.
+                   const auto revision = last_revision_;
+                   if ( !renew() ) {
+                     if ( still() )
+                       renderer.still();
+                     return;
+                   }
+                   // A reconfigured bar may need more room than what was made for it at boot.
+                   if ( revision != last_revision_ )
+                     PGBAR__UNLIKELY ostream.reserve( config_.frame_capacity() );
                    if ( istty ) {
                      if PGBAR__CXX17_CNSTXPR ( Area == Region::Fixed )
                        ostream << console::escodes::resetcursor;
@@ -370,7 +633,10 @@ namespace pgbar {
             PGBAR__UNLIKELY throw exception::InvalidState(
               charcodes::make_literal( "pgbar: another progress bar instance is already running" ) );
 
-          io::OStream<Outlet>::itself() << io::release; // reset the state.
+          io::OStream<Outlet>::itself() << io::reset; // reset the state.
+          io::OStream<Outlet>::itself().template engage<Mode>();
+          // Make room for the frames up front, so no allocation is left for the rendering.
+          io::OStream<Outlet>::itself().reserve( config_.frame_capacity() );
           auto guard = utils::make_scope_fail( [&executor]() noexcept { executor.dismiss(); } );
           executor.template activate<Mode>();
         }
@@ -672,6 +938,105 @@ namespace pgbar {
         }
       };
 
+      /**
+       * A non-shared handle that accumulates ticks in a local counter,
+       * and publishes them to the bar every `batch` ticks, once per `deadline`, or on destruction.
+
+       * The clock is sampled at an adaptive rate, so most ticks cost nothing but an increment.
+       */
+      template<typename Bar>
+      class LocalTicker final {
+        using Clock = std::chrono::steady_clock;
+
+        Bar* bar_;
+        std::uint64_t pending_;
+        std::uint64_t checkpoint_; // the value of `pending_` at which the slow path is taken
+        std::uint64_t batch_;
+        std::uint64_t probe_; // the number of ticks between two clock readings
+        TimeGranule deadline_;
+        Clock::time_point last_flush_, last_probe_;
+
+        PGBAR__NOINLINE void reach_checkpoint() &
+        {
+          if ( pending_ >= batch_ )
+            return flush();
+
+          const auto now = Clock::now();
+          if ( now - last_flush_ >= deadline_ )
+            return flush();
+          // Read the clock less often if the ticks are dense, and more often if they are sparse.
+          if ( now - last_probe_ < deadline_ / 8 )
+            probe_ = probe_ * 2 < batch_ ? probe_ * 2 : batch_;
+          else if ( probe_ > 1 )
+            probe_ /= 2;
+          last_probe_ = now;
+          checkpoint_ = pending_ + probe_ < batch_ ? pending_ + probe_ : batch_;
+        }
+
+      public:
+        LocalTicker( const LocalTicker& )              = delete;
+        LocalTicker& operator=( const LocalTicker& ) & = delete;
+
+        // A zero `deadline` means that the ticks are only published in batches.
+        LocalTicker( Bar& bar, std::uint64_t batch, TimeGranule deadline ) noexcept
+          : bar_ { std::addressof( bar ) }
+          , pending_ { 0 }
+          , batch_ { batch == 0 ? 1 : batch }
+          , probe_ { 1 }
+          , deadline_ { deadline }
+          , last_flush_ { Clock::now() }
+          , last_probe_ { last_flush_ }
+        {
+          checkpoint_ = deadline_ > TimeGranule::zero() ? probe_ : batch_;
+        }
+        LocalTicker( LocalTicker&& rhs ) noexcept
+          : bar_ { rhs.bar_ }
+          , pending_ { rhs.pending_ }
+          , checkpoint_ { rhs.checkpoint_ }
+          , batch_ { rhs.batch_ }
+          , probe_ { rhs.probe_ }
+          , deadline_ { rhs.deadline_ }
+          , last_flush_ { rhs.last_flush_ }
+          , last_probe_ { rhs.last_probe_ }
+        {
+          rhs.bar_     = nullptr;
+          rhs.pending_ = 0;
+        }
+        LocalTicker& operator=( LocalTicker&& ) & = delete;
+        // The exception thrown by the last publication is discarded here;
+        // call `flush()` in advance if it matters.
+        ~LocalTicker() noexcept
+        {
+          if ( bar_ != nullptr && pending_ != 0 ) {
+            try {
+              flush();
+            } catch ( ... ) {
+            }
+          }
+        }
+
+        PGBAR__FORCEINLINE void tick() &
+        {
+          if ( ++pending_ >= checkpoint_ )
+            PGBAR__UNLIKELY reach_checkpoint();
+        }
+        // Publish all accumulated ticks to the bar immediately.
+        void flush() &
+        {
+          PGBAR__ASSERT( bar_ != nullptr );
+          last_flush_ = last_probe_ = Clock::now();
+          checkpoint_               = deadline_ > TimeGranule::zero() ? probe_ : batch_;
+          if ( pending_ != 0 ) {
+            const auto num_ticks = pending_;
+            pending_             = 0;
+            bar_->tick( num_ticks );
+          }
+        }
+
+        // Get the number of ticks that haven't been published yet.
+        PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t pending() const noexcept { return pending_; }
+      };
+
       template<typename Base, typename Derived>
       class TickableBar : public Base {
       public:
@@ -682,16 +1047,16 @@ namespace pgbar {
 
         PGBAR__FORCEINLINE void tick() & final
         {
-          static_cast<Derived*>( this )->do_tick(
-            [this]() noexcept { this->task_cnt_.fetch_add( 1, std::memory_order_release ); } );
+          if ( !config::enabled() )
+            return;
+          static_cast<Derived*>( this )->do_tick( [this]() noexcept { return this->increase_counter(); } );
         }
         PGBAR__FORCEINLINE void tick( std::uint64_t next_step ) &
         {
-          static_cast<Derived*>( this )->do_tick( [&]() noexcept {
-            const auto task_cnt = this->task_cnt_.load( std::memory_order_acquire );
-            this->task_cnt_.fetch_add( task_cnt + next_step > this->task_end_ ? this->task_end_ - task_cnt
-                                                                              : next_step );
-          } );
+          if ( !config::enabled() )
+            return;
+          static_cast<Derived*>( this )->do_tick(
+            [&]() noexcept { return this->advance_counter( next_step ); } );
         }
         /**
          * Set the iteration step of the progress bar to a specified percentage.
@@ -702,12 +1067,15 @@ namespace pgbar {
          */
         PGBAR__FORCEINLINE void tick_to( std::uint8_t percentage ) &
         {
+          if ( !config::enabled() )
+            return;
           static_cast<Derived*>( this )->do_tick( [&]() noexcept {
             auto updater = [this]( std::uint64_t target ) noexcept {
+              this->fold_counter();
               auto current = this->task_cnt_.load( std::memory_order_acquire );
               while ( !this->task_cnt_.compare_exchange_weak( current,
                                                               target,
-                                                              std::memory_order_release,
+                                                              std::memory_order_seq_cst,
                                                               std::memory_order_acquire )
                       && target <= current ) {}
             };
@@ -717,8 +1085,58 @@ namespace pgbar {
               updater( target );
             } else
               updater( this->task_end_ );
+            return Gate::Visible;
           } );
         }
+
+        /**
+         * Activate the bar up front, so that the following ticks never need to.
+         * Ignore the call if the bar is already active.
+         */
+        void start() &
+        {
+          if ( config::enabled() )
+            static_cast<Derived*>( this )->do_start();
+        }
+        /**
+         * The same as `tick()`, but assumes that the bar has been activated by `start()`,
+         * so there's neither locking nor throwing on this path.
+
+         * If the rendering or the action callback fails,
+         * the exception is rethrown when the bar is activated next time.
+         */
+        PGBAR__FORCEINLINE void tick_unchecked() & noexcept
+        {
+          if ( !config::enabled() )
+            return;
+          static_cast<Derived*>( this )->do_tick_unchecked(
+            [this]() noexcept { return this->increase_counter(); } );
+        }
+        PGBAR__FORCEINLINE void tick_unchecked( std::uint64_t next_step ) & noexcept
+        {
+          if ( !config::enabled() )
+            return;
+          static_cast<Derived*>( this )->do_tick_unchecked(
+            [&]() noexcept { return this->advance_counter( next_step ); } );
+        }
+
+        /**
+         * Create a handle that publishes its ticks to this bar in batches,
+         * which is cheaper than calling `tick()` for every item in a tight loop.
+
+         * The ticks are published every `batch` ticks, or at least once per refresh interval.
+         * The handle must not outlive the bar, and is meant to be used by one thread only.
+         */
+        PGBAR__NODISCARD LocalTicker<Derived> local_ticker( std::uint64_t batch ) & noexcept
+        {
+          return local_ticker( batch, render::Renderer<Derived::Sink>::working_interval() );
+        }
+        // A zero `deadline` means that the ticks are only published in batches.
+        PGBAR__NODISCARD LocalTicker<Derived> local_ticker( std::uint64_t batch,
+                                                            TimeGranule deadline ) & noexcept
+        {
+          return { static_cast<Derived&>( *this ), batch, deadline };
+        }
       };
 
       template<typename Base, typename Derived>
@@ -749,7 +1167,8 @@ namespace pgbar {
         {
           PGBAR__ASSERT( this->task_cnt_ <= this->task_end_ );
           this->config_.build( io::OStream<Outlet>::itself(),
-                               this->task_cnt_.load( std::memory_order_acquire ),
+                               console::TermContext<Outlet>::itself().columns(),
+                               this->current_counter(),
                                this->task_end_,
                                this->zero_point_ );
         }
@@ -758,6 +1177,22 @@ namespace pgbar {
           refreshframe();
           this->state_.store( State::Stop, std::memory_order_release );
         }
+        // The fraction of the finished tasks.
+        PGBAR__NODISCARD PGBAR__FORCEINLINE types::Float ratio() const noexcept
+        {
+          return static_cast<types::Float>( this->current_counter() ) / this->task_end_;
+        }
+        // The counter and the time stamp that the next frame is built from.
+        PGBAR__NODISCARD std::pair<std::uint64_t, std::uint64_t> generation() const noexcept
+        {
+          const auto task_cnt = this->current_counter();
+          return { task_cnt,
+                   this->config_.time_stamp( task_cnt, this->task_end_, this->zero_point_, false ) };
+        }
+        PGBAR__NODISCARD PGBAR__FORCEINLINE bool time_driven() const noexcept
+        {
+          return this->config_.time_driven( false );
+        }
 
         PGBAR__FORCEINLINE typename Base::StateCategory categorize() const noexcept
         {
@@ -779,49 +1214,94 @@ namespace pgbar {
           } else
             state_.store( State::Stop, std::memory_order_release );
         }
+        void do_start() & noexcept( false )
+        {
+          std::lock_guard<std::mutex> lock { this->mtx_ };
+          if ( state_.load( std::memory_order_acquire ) == State::Stop ) {
+            this->task_end_ = this->config_.tasks();
+            if ( this->task_end_ == 0 )
+              PGBAR__UNLIKELY throw exception::InvalidState(
+                charcodes::make_literal( "pgbar: the number of tasks is zero" ) );
+
+            if ( config::auto_style_off() && !config::intty( Outlet ) )
+              this->config_.colored( false ).bolded( false );
+            this->reset_counter( Mode == Policy::Async,
+                                 Mode != Policy::Async && Mode != Policy::External && time_driven(),
+                                 this->config_.visible_stride( this->task_end_ ),
+                                 this->config_.revision() );
+            this->forget_frame();
+            this->zero_point_ = std::chrono::steady_clock::now();
+            state_.store( State::Awake, std::memory_order_release );
+
+            auto guard = utils::make_scope_fail(
+              [this]() noexcept { state_.store( State::Stop, std::memory_order_release ); } );
+            this->do_boot();
+          }
+        }
+        // Stop the bar once all tasks are done; when "Nothrow" is true,
+        // an exception thrown by the action callback is left for the next activation to rethrow.
+        template<bool Nothrow>
+        void finish() noexcept( Nothrow )
+        {
+          if PGBAR__CXX17_CNSTXPR ( !Nothrow )
+            return do_reset<false>();
+          try {
+            do_reset<false>();
+          } catch ( ... ) {
+            render::Renderer<Outlet>::itself().stash( std::current_exception() );
+            // The tasks are done all the same, so the bar still renders its last frame.
+            state_.store( State::Finish, std::memory_order_release );
+            this->do_halt( false );
+          }
+        }
+        // Only when "Nothrow" is true will it be noexcept,
+        // and then the exception thrown during rendering will be rethrown by the next activation.
+        template<bool Nothrow, typename F>
+        PGBAR__FORCEINLINE void do_advance( F&& ticker ) & noexcept( Nothrow )
+        {
+          const auto gate = ticker();
+
+          if ( this->task_cnt_.load( std::memory_order_acquire ) >= this->task_end_ )
+            PGBAR__UNLIKELY
+            {
+              if ( this->mtx_.try_lock() ) {
+                std::lock_guard<std::mutex> lock { this->mtx_, std::adopt_lock };
+                finish<Nothrow>();
+              }
+            }
+          else if ( !this->passes(
+                      gate,
+                      this->config_.revision(),
+                      render::Renderer<Outlet>::working_interval(),
+                      [this]() noexcept { return this->config_.visible_stride( this->task_end_ ); } ) )
+            return;
+          else if PGBAR__CXX17_CNSTXPR ( Nothrow )
+            render::Renderer<Outlet>::itself().template commit_nothrow<Mode>();
+          else
+            render::Renderer<Outlet>::itself().template commit<Mode>();
+        }
         template<typename F>
         void do_tick( F&& ticker ) & noexcept( false )
         {
           switch ( state_.load( std::memory_order_acquire ) ) {
           case State::Stop:  PGBAR__FALLTHROUGH;
           case State::Awake: {
-            std::lock_guard<std::mutex> lock { this->mtx_ };
-            if ( state_.load( std::memory_order_acquire ) == State::Stop ) {
-              this->task_end_ = this->config_.tasks();
-              if ( this->task_end_ == 0 )
-                PGBAR__UNLIKELY throw exception::InvalidState(
-                  charcodes::make_literal( "pgbar: the number of tasks is zero" ) );
-
-              if ( config::auto_style_off() && !config::intty( Outlet ) )
-                this->config_.colored( false ).bolded( false );
-              this->task_cnt_.store( 0, std::memory_order_release );
-              this->zero_point_ = std::chrono::steady_clock::now();
-              state_.store( State::Awake, std::memory_order_release );
-
-              auto guard = utils::make_scope_fail(
-                [this]() noexcept { state_.store( State::Stop, std::memory_order_release ); } );
-              this->do_boot();
-            }
+            do_start();
           }
             PGBAR__FALLTHROUGH;
           case State::Refresh: {
-            ticker();
-
-            if ( this->task_cnt_.load( std::memory_order_acquire ) >= this->task_end_ )
-              PGBAR__UNLIKELY
-              {
-                if ( this->mtx_.try_lock() ) {
-                  std::lock_guard<std::mutex> lock { this->mtx_, std::adopt_lock };
-                  do_reset<false>();
-                }
-              }
-            else
-              render::Renderer<Outlet>::itself().template commit<Mode>();
+            do_advance<false>( std::forward<F>( ticker ) );
           } break;
 
           default: utils::unreachable();
           }
         }
+        template<typename F>
+        PGBAR__FORCEINLINE void do_tick_unchecked( F&& ticker ) & noexcept
+        {
+          PGBAR__ASSERT( state_.load( std::memory_order_acquire ) != State::Stop );
+          do_advance<true>( std::forward<F>( ticker ) );
+        }
 
       public:
         PlainBar( const PlainBar& )              = delete;
@@ -878,8 +1358,9 @@ namespace pgbar {
         {
           PGBAR__ASSERT( this->task_cnt_ <= this->task_end_ );
           this->config_.build( io::OStream<Outlet>::itself(),
+                               console::TermContext<Outlet>::itself().columns(),
                                this->idx_frame_,
-                               this->task_cnt_.load( std::memory_order_acquire ),
+                               this->current_counter(),
                                this->task_end_,
                                this->zero_point_ );
           ++this->idx_frame_;
@@ -888,12 +1369,31 @@ namespace pgbar {
         {
           PGBAR__ASSERT( this->task_cnt_ <= this->task_end_ );
           this->config_.build( io::OStream<Outlet>::itself(),
+                               console::TermContext<Outlet>::itself().columns(),
                                this->idx_frame_,
-                               this->task_cnt_.load( std::memory_order_acquire ),
+                               this->current_counter(),
                                this->task_end_,
                                this->zero_point_ );
           state_.store( State::Stop, std::memory_order_release );
         }
+        // The fraction of the finished tasks, or a negative value if the number of tasks is unlimited.
+        PGBAR__NODISCARD PGBAR__FORCEINLINE types::Float ratio() const noexcept
+        {
+          return this->task_end_ == 0
+                 ? -1
+                 : static_cast<types::Float>( this->current_counter() ) / this->task_end_;
+        }
+        // The counter and the time stamp that the next frame is built from, the animation moves by itself.
+        PGBAR__NODISCARD std::pair<std::uint64_t, std::uint64_t> generation() const noexcept
+        {
+          const auto task_cnt = this->current_counter();
+          return { task_cnt,
+                   this->config_.time_stamp( task_cnt, this->task_end_, this->zero_point_, true ) };
+        }
+        PGBAR__NODISCARD PGBAR__FORCEINLINE bool time_driven() const noexcept
+        {
+          return this->config_.time_driven( true );
+        }
 
         PGBAR__FORCEINLINE typename Base::StateCategory categorize() const noexcept
         {
@@ -922,53 +1422,98 @@ namespace pgbar {
           } else
             state_.store( State::Stop, std::memory_order_release );
         }
-        template<typename F>
-        void do_tick( F&& ticker ) & noexcept( false )
+        void do_start() & noexcept( false )
         {
-          switch ( this->state_.load( std::memory_order_acquire ) ) {
-          case State::Stop:  PGBAR__FALLTHROUGH;
-          case State::Awake: {
-            std::lock_guard<std::mutex> lock { this->mtx_ };
-            if ( this->state_.load( std::memory_order_acquire ) == State::Stop ) {
-              this->task_end_ = this->config_.tasks();
-              static_cast<Subcls*>( this )->warmup();
-
-              if ( config::auto_style_off() && !config::intty( Outlet ) )
-                this->config_.colored( false ).bolded( false );
-              this->task_cnt_.store( 0, std::memory_order_release );
-              this->zero_point_ = std::chrono::steady_clock::now();
-              this->state_.store( State::Awake, std::memory_order_release );
-
-              auto guard = utils::make_scope_fail(
-                [this]() noexcept { this->state_.store( State::Stop, std::memory_order_release ); } );
-              this->do_boot();
-            }
-            if ( this->state_.load( std::memory_order_acquire ) == State::ActivityRefresh )
-              return;
+          std::lock_guard<std::mutex> lock { this->mtx_ };
+          if ( this->state_.load( std::memory_order_acquire ) == State::Stop ) {
+            this->task_end_ = this->config_.tasks();
+            static_cast<Subcls*>( this )->warmup();
+
+            if ( config::auto_style_off() && !config::intty( Outlet ) )
+              this->config_.colored( false ).bolded( false );
+            this->reset_counter( Mode == Policy::Async,
+                                 Mode != Policy::Async && Mode != Policy::External && time_driven(),
+                                 this->config_.visible_stride( this->task_end_ ),
+                                 this->config_.revision() );
+            this->forget_frame();
+            this->zero_point_ = std::chrono::steady_clock::now();
+            this->state_.store( State::Awake, std::memory_order_release );
+
+            auto guard = utils::make_scope_fail(
+              [this]() noexcept { this->state_.store( State::Stop, std::memory_order_release ); } );
+            this->do_boot();
           }
-            PGBAR__FALLTHROUGH;
-          case State::ProgressRefresh: {
-            ticker();
+        }
+        // Stop the bar once all tasks are done; when "Nothrow" is true,
+        // an exception thrown by the action callback is left for the next activation to rethrow.
+        template<bool Nothrow>
+        void finish() noexcept( Nothrow )
+        {
+          if PGBAR__CXX17_CNSTXPR ( !Nothrow )
+            return do_reset<false>();
+          try {
+            do_reset<false>();
+          } catch ( ... ) {
+            render::Renderer<Outlet>::itself().stash( std::current_exception() );
+            // The tasks are done all the same, so the bar still renders its last frame.
+            this->state_.store( State::Finish, std::memory_order_release );
+            this->do_halt( false );
+          }
+        }
+        // Only when "Nothrow" is true will it be noexcept,
+        // and then the exception thrown during rendering will be rethrown by the next activation.
+        template<bool Nothrow, typename F>
+        PGBAR__FORCEINLINE void do_advance( F&& ticker ) & noexcept( Nothrow )
+        {
+          if ( this->task_end_ != 0 ) {
+            const auto gate = ticker();
 
             if ( this->task_cnt_.load( std::memory_order_acquire ) >= this->task_end_ )
               PGBAR__UNLIKELY
               {
                 if ( this->mtx_.try_lock() ) {
                   std::lock_guard<std::mutex> lock { this->mtx_, std::adopt_lock };
-                  do_reset<false>();
+                  finish<Nothrow>();
                 }
+                return;
               }
-            else
-              render::Renderer<Outlet>::itself().template commit<Mode>();
-          } break;
-
-          case State::ActivityRefresh: {
+            else if ( !this->passes(
+                        gate,
+                        this->config_.revision(),
+                        render::Renderer<Outlet>::working_interval(),
+                        [this]() noexcept { return this->config_.visible_stride( this->task_end_ ); } ) )
+              return;
+          }
+          if PGBAR__CXX17_CNSTXPR ( Nothrow )
+            render::Renderer<Outlet>::itself().template commit_nothrow<Mode>();
+          else
             render::Renderer<Outlet>::itself().template commit<Mode>();
+        }
+        template<typename F>
+        void do_tick( F&& ticker ) & noexcept( false )
+        {
+          switch ( this->state_.load( std::memory_order_acquire ) ) {
+          case State::Stop:  PGBAR__FALLTHROUGH;
+          case State::Awake: {
+            do_start();
+            if ( this->state_.load( std::memory_order_acquire ) == State::ActivityRefresh )
+              return;
+          }
+            PGBAR__FALLTHROUGH;
+          case State::ProgressRefresh: PGBAR__FALLTHROUGH;
+          case State::ActivityRefresh: {
+            do_advance<false>( std::forward<F>( ticker ) );
           } break;
 
           default: utils::unreachable();
           }
         }
+        template<typename F>
+        PGBAR__FORCEINLINE void do_tick_unchecked( F&& ticker ) & noexcept
+        {
+          PGBAR__ASSERT( this->state_.load( std::memory_order_acquire ) != State::Stop );
+          do_advance<true>( std::forward<F>( ticker ) );
+        }
 
       public:
         FrameBar( const FrameBar& )              = delete;
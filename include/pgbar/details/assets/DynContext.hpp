@@ -19,14 +19,31 @@ namespace pgbar {
             PGBAR__TRUST( item != nullptr );
             make_frame( static_cast<Derived&>( *item ) );
           }
+          template<typename Derived>
+          static bool probe( Indicator* item ) noexcept
+          {
+            PGBAR__TRUST( item != nullptr );
+            return renew( static_cast<Derived&>( *item ) );
+          }
+          template<typename Derived>
+          static bool settled( const Indicator* item ) noexcept
+          {
+            PGBAR__TRUST( item != nullptr );
+            return still( static_cast<const Derived&>( *item ) );
+          }
 
         public:
           void ( *render_ )( Indicator* );
+          bool ( *renew_ )( Indicator* );
+          bool ( *still_ )( const Indicator* );
           Indicator* target_;
 
           template<typename Config>
           Slot( prefabs::ManagedBar<Config, Outlet, Mode, Area>* item ) noexcept
-            : render_ { render<prefabs::BasicBar<Config, Outlet, Mode, Area>> }, target_ { item }
+            : render_ { render<prefabs::BasicBar<Config, Outlet, Mode, Area>> }
+            , renew_ { probe<prefabs::BasicBar<Config, Outlet, Mode, Area>> }
+            , still_ { settled<prefabs::BasicBar<Config, Outlet, Mode, Area>> }
+            , target_ { item }
           {}
         };
 
@@ -36,6 +53,8 @@ namespace pgbar {
         // If Area is equal to Region::Relative,
         // the variable represents the number of nextlines output last time.
         std::atomic<std::uint64_t> num_modified_lines_ = { 0 };
+        // Whether `items_` has changed since the last frame, it's guarded by `res_mtx_`.
+        bool reshaped_                                 = false;
         mutable concurrent::SharedMutex res_mtx_       = {};
         mutable std::mutex sched_mtx_                  = {};
 
@@ -101,6 +120,25 @@ namespace pgbar {
           }
         }
 
+        // Return false if neither the bars nor their layout would look different in the next frame.
+        PGBAR__NODISCARD bool renew_all() & noexcept
+        {
+          bool renewed = reshaped_;
+          reshaped_    = false;
+          for ( const auto& item : items_ )
+            if ( item.target_ != nullptr )
+              renewed |= ( *item.renew_ )( item.target_ );
+          return renewed;
+        }
+        // Return true if none of the bars would change with the time alone.
+        PGBAR__NODISCARD bool still_all() const noexcept
+        {
+          for ( const auto& item : items_ )
+            if ( item.target_ != nullptr && !( *item.still_ )( item.target_ ) )
+              return false;
+          return true;
+        }
+
         void eliminate() noexcept
         {
           // Search for the first k stopped progress bars and remove them.
@@ -163,16 +201,26 @@ namespace pgbar {
                        if ( istty )
                          ostream << console::escodes::savecursor;
                      {
+                       // The frame may reference the bytes of the bars, so it's written before any is popped.
                        concurrent::SharedLock<concurrent::SharedMutex> lock { res_mtx_ };
                        do_render();
+                       ostream << io::flush;
                      }
-                     ostream << io::flush;
                      auto expected = State::Awake;
                      state_.compare_exchange_strong( expected, State::Refresh, std::memory_order_release );
                    } break;
                    case State::Refresh: {
+                     // The bars don't share a common progress, so only the time matters here.
+                     if ( !istty && !render::Renderer<Outlet>::itself().admit( -1 ) )
+                       break;
                      {
                        concurrent::SharedLock<concurrent::SharedMutex> lock { res_mtx_ };
+                       // Neither the build nor the write is needed if the frame would look the same.
+                       if ( !renew_all() ) {
+                         if ( still_all() )
+                           render::Renderer<Outlet>::itself().still();
+                         break;
+                       }
                        if ( istty ) {
                          if PGBAR__CXX17_CNSTXPR ( Area == Region::Fixed ) {
                            ostream << console::escodes::resetcursor;
@@ -193,8 +241,8 @@ namespace pgbar {
                          }
                        }
                        do_render();
+                       ostream << io::flush;
                      }
-                     ostream << io::flush;
                    } break;
                    default: return;
                    }
@@ -202,7 +250,8 @@ namespace pgbar {
               PGBAR__UNLIKELY throw exception::InvalidState(
                 charcodes::make_literal( "pgbar: another progress bar instance is already running" ) );
 
-            io::OStream<Outlet>::itself() << io::release;
+            io::OStream<Outlet>::itself() << io::reset;
+            io::OStream<Outlet>::itself().template engage<Mode>();
             num_modified_lines_.store( 0, std::memory_order_relaxed );
             state_.store( State::Awake, std::memory_order_release );
 
@@ -214,6 +263,7 @@ namespace pgbar {
             {
               std::lock_guard<concurrent::SharedMutex> lock2 { res_mtx_ };
               items_.emplace_back( item );
+              reshaped_ = true;
             }
             executor.template activate<Mode>();
           } else {
@@ -221,6 +271,7 @@ namespace pgbar {
               std::lock_guard<concurrent::SharedMutex> lock2 { res_mtx_ };
               eliminate();
               items_.emplace_back( item );
+              reshaped_ = true;
             }
             executor.template trigger<Mode>();
           }
@@ -245,13 +296,16 @@ namespace pgbar {
             if ( itr != items_.end() )
               itr->target_ = nullptr;
             eliminate();
+            reshaped_ = true;
             suspend_flag = items_.empty();
           }
 
           if ( suspend_flag ) {
             state_.store( State::Stop, std::memory_order_release );
-            executor.dismiss_then( []() noexcept { io::OStream<Outlet>::itself().release(); } );
-          }
+            executor.dismiss_then( []() noexcept { io::OStream<Outlet>::itself().reset(); } );
+          } else
+            executor.rouse(); // the layout has changed after the frame triggered above
+
         }
 
         PGBAR__NODISCARD PGBAR__FORCEINLINE types::Size online_count() const noexcept
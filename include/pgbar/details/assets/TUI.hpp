@@ -45,7 +45,7 @@ namespace pgbar {
 #undef PGBAR__UNPAKING
 
       protected:
-        mutable concurrent::SharedMutex rw_mtx_;
+        mutable concurrent::RevisedMutex rw_mtx_;
         enum class Mask : std::uint8_t { Colored = 0, Bolded };
         std::bitset<2> fonts_;
 
@@ -89,9 +89,9 @@ namespace pgbar {
         }
         ~CoreConfig() = default;
 
-#define PGBAR__METHOD( OptionName, ReturnType )              \
-  std::lock_guard<concurrent::SharedMutex> lock { rw_mtx_ }; \
-  unpack( *this, option::OptionName( _enable ) );            \
+#define PGBAR__METHOD( OptionName, ReturnType )               \
+  std::lock_guard<concurrent::RevisedMutex> lock { rw_mtx_ }; \
+  unpack( *this, option::OptionName( _enable ) );             \
   return static_cast<ReturnType>( *this )
 
         // Enable or disable the color effect.
@@ -102,8 +102,8 @@ namespace pgbar {
         Derived&& bolded( bool _enable ) && noexcept { PGBAR__METHOD( Bolded, Derived&& ); }
 
 #undef PGBAR__METHOD
-#define PGBAR__METHOD( Offset )                                     \
-  concurrent::SharedLock<concurrent::SharedMutex> lock { rw_mtx_ }; \
+#define PGBAR__METHOD( Offset )                                      \
+  concurrent::SharedLock<concurrent::RevisedMutex> lock { rw_mtx_ }; \
   return fonts_[utils::to_underlying( Mask::Offset )]
 
         // Check whether the color effect is enabled.
@@ -131,9 +131,9 @@ namespace pgbar {
         constexpr Countable() = default;
         PGBAR__NONEMPTY_COMPONENT( Countable, PGBAR__CXX14_CNSTXPR )
 
-#define PGBAR__METHOD( ReturnType )                                \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ }; \
-  unpack( *this, option::Tasks( param ) );                         \
+#define PGBAR__METHOD( ReturnType )                                 \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ }; \
+  unpack( *this, option::Tasks( param ) );                          \
   return static_cast<ReturnType>( *this )
 
         // Set the number of tasks, passing in zero is no exception.
@@ -144,7 +144,7 @@ namespace pgbar {
         // Get the current number of tasks.
         PGBAR__NODISCARD std::uint64_t tasks() const noexcept
         {
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
           return task_quota_;
         }
 
@@ -170,9 +170,9 @@ namespace pgbar {
         constexpr Reversible() = default;
         PGBAR__NONEMPTY_COMPONENT( Reversible, PGBAR__CXX14_CNSTXPR )
 
-#define PGBAR__METHOD( ReturnType )                                \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ }; \
-  unpack( *this, option::Reversed( flag ) );                       \
+#define PGBAR__METHOD( ReturnType )                                 \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ }; \
+  unpack( *this, option::Reversed( flag ) );                        \
   return static_cast<ReturnType>( *this )
 
         Derived& reverse( bool flag ) & noexcept { PGBAR__METHOD( Derived& ); }
@@ -182,7 +182,7 @@ namespace pgbar {
 
         PGBAR__NODISCARD bool reverse() const noexcept
         {
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
           return reversed_;
         }
 
@@ -233,7 +233,7 @@ namespace pgbar {
         PGBAR__NONEMPTY_COMPONENT( Frames, PGBAR__CXX20_CNSTXPR )
 
 #define PGBAR__METHOD( OptionName, ParamName, ReturnType, Operation ) \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ };    \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ };   \
   unpack( *this, option::OptionName( Operation( ParamName ) ) );      \
   return static_cast<ReturnType>( *this )
 
@@ -305,7 +305,7 @@ namespace pgbar {
         PGBAR__NONEMPTY_COMPONENT( Filler, PGBAR__CXX20_CNSTXPR )
 
 #define PGBAR__METHOD( OptionName, ParamName, ReturnType, Operation ) \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ };    \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ };   \
   unpack( *this, option::OptionName( Operation( ParamName ) ) );      \
   return static_cast<ReturnType>( *this )
 
@@ -360,7 +360,7 @@ namespace pgbar {
         PGBAR__NONEMPTY_COMPONENT( Remains, PGBAR__CXX20_CNSTXPR )
 
 #define PGBAR__METHOD( OptionName, ParamName, ReturnType, Operation ) \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ };    \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ };   \
   unpack( *this, option::OptionName( Operation( ParamName ) ) );      \
   return static_cast<ReturnType>( *this )
 
@@ -413,9 +413,9 @@ namespace pgbar {
         PGBAR__CXX20_CNSTXPR BasicAnimation() = default;
         PGBAR__NONEMPTY_COMPONENT( BasicAnimation, PGBAR__CXX20_CNSTXPR )
 
-#define PGBAR__METHOD( ReturnType )                                \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ }; \
-  unpack( *this, option::Shift( _shift_factor ) );                 \
+#define PGBAR__METHOD( ReturnType )                                 \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ }; \
+  unpack( *this, option::Shift( _shift_factor ) );                  \
   return static_cast<ReturnType>( *this )
 
         /**
@@ -468,7 +468,7 @@ namespace pgbar {
         PGBAR__NONEMPTY_COMPONENT( BasicIndicator, PGBAR__CXX20_CNSTXPR )
 
 #define PGBAR__METHOD( OptionName, ParamName, ReturnType, Operation ) \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ };    \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ };   \
   unpack( *this, option::OptionName( Operation( ParamName ) ) );      \
   return static_cast<ReturnType>( *this )
 
@@ -527,7 +527,7 @@ namespace pgbar {
 
         PGBAR__NODISCARD std::uint16_t bar_width() const noexcept
         {
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
           return bar_width_;
         }
 
@@ -576,7 +576,7 @@ namespace pgbar {
         PGBAR__NONEMPTY_COMPONENT( Prefix, PGBAR__CXX20_CNSTXPR )
 
 #define PGBAR__METHOD( OptionName, ParamName, ReturnType, Operation ) \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ };    \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ };   \
   unpack( *this, option::OptionName( Operation( ParamName ) ) );      \
   return static_cast<ReturnType>( *this )
 
@@ -627,13 +627,19 @@ namespace pgbar {
         charcodes::U8Raw postfix_;
         console::escodes::RGBColor pstfx_col_;
 
+        // Cut `num_cut` columns off the end of the postfix, or drop it if there's nothing left.
         PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR io::CharPipeline& build_postfix(
-          io::CharPipeline& buffer ) const
+          io::CharPipeline& buffer,
+          types::Size num_cut = 0 ) const
         {
-          if ( postfix_.empty() )
+          if ( postfix_.empty() || ( num_cut != 0 && num_cut >= postfix_.width() ) )
             return buffer;
           this->try_reset( buffer );
-          return this->try_style( buffer, pstfx_col_ ) << ' ' << postfix_;
+          this->try_style( buffer, pstfx_col_ ) << ' ';
+          if ( num_cut == 0 )
+            return buffer << postfix_;
+          return buffer.append( postfix_.data(),
+                                postfix_.data() + postfix_.fit( postfix_.width() - num_cut ) );
         }
 
         PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR types::Size fixed_len_postfix()
@@ -647,7 +653,7 @@ namespace pgbar {
         PGBAR__NONEMPTY_COMPONENT( Postfix, PGBAR__CXX20_CNSTXPR )
 
 #define PGBAR__METHOD( OptionName, ParamName, ReturnType, Operation ) \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ };    \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ };   \
   unpack( *this, option::OptionName( Operation( ParamName ) ) );      \
   return static_cast<ReturnType>( *this )
 
@@ -718,7 +724,7 @@ namespace pgbar {
         PGBAR__NONEMPTY_COMPONENT( Segment, PGBAR__CXX20_CNSTXPR )
 
 #define PGBAR__METHOD( OptionName, ParamName, ReturnType, Operation ) \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ };    \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ };   \
   unpack( *this, option::OptionName( Operation( ParamName ) ) );      \
   return static_cast<ReturnType>( *this )
 
@@ -810,9 +816,15 @@ namespace pgbar {
           if ( num_percent <= 0.0 ) // 0.01%
             PGBAR__UNLIKELY return buffer << PGBAR__DEFAULT_PERCENT;
 
-          auto orig = utils::format( num_percent * 100.0, 2 );
-          orig.push_back( '%' );
-          return buffer << utils::format<utils::TxtLayout::Right>( fixed_len_percent(), std::move( orig ) );
+          // At most "100.00", plus the room `utils::format_to` asks for.
+          types::Char digits[fixed_len_percent()];
+          PGBAR__ASSERT( utils::format_size( num_percent * 100.0, 2 ) <= sizeof( digits ) );
+          const auto last   = utils::format_to( digits, num_percent * 100.0, 2 );
+          const auto length = static_cast<types::Size>( last - digits );
+          // Pad in place rather than building an aligned copy of the digits.
+          if ( length + 1 < fixed_len_percent() )
+            buffer.append( ' ', fixed_len_percent() - length - 1 );
+          return buffer.append( digits, last ) << '%';
         }
 
         PGBAR__NODISCARD static PGBAR__FORCEINLINE PGBAR__CNSTEVAL types::Size fixed_len_percent() noexcept
@@ -860,8 +872,8 @@ namespace pgbar {
         {
           PGBAR__TRUST( num_task_done <= num_all_tasks );
           if ( num_all_tasks == 0 )
-            PGBAR__UNLIKELY return buffer
-              << utils::format<utils::TxtLayout::Right>( fixed_len_speed(), u8"-- " + units_.front() );
+            PGBAR__UNLIKELY return pad_speed( buffer, 3 + units_.front().size() )
+              << u8"-- " << units_.front();
 
           /* Since the cube of the maximum value of std::uint16_t does not exceed
            * the representable range of std::uint64_t,
@@ -875,36 +887,50 @@ namespace pgbar {
           const types::Float frequency = seconds_passed <= 0.0 ? ( std::numeric_limits<types::Float>::max )()
                                                                : num_task_done / seconds_passed;
 
-          types::String orig;
+          types::Size nth_unit = 0;
+          types::Float scaled  = frequency;
           if ( frequency < magnitude_ )
-            orig = utils::format( frequency, 2 ) + ' ' + units_[0];
-          else if ( frequency < tier1 ) // "kilo"
-            orig = utils::format( frequency / magnitude_, 2 ) + ' ' + units_[1];
-          else if ( frequency < tier2 ) // "Mega"
-            orig = utils::format( frequency / tier1, 2 ) + ' ' + units_[2];
-          else { // "Giga" or "infinity"
-            const types::Float remains = frequency / tier2;
-            if ( remains > magnitude_ )
-              PGBAR__UNLIKELY orig = PGBAR__DEFAULT_SPEED + units_[3];
-            else
-              orig = utils::format( remains, 2 ) + ' ' + units_[3];
+            nth_unit = 0;
+          else if ( frequency < tier1 ) { // "kilo"
+            nth_unit = 1;
+            scaled   = frequency / magnitude_;
+          } else if ( frequency < tier2 ) { // "Mega"
+            nth_unit = 2;
+            scaled   = frequency / tier1;
+          } else { // "Giga" or "infinity"
+            nth_unit = 3;
+            scaled   = frequency / tier2;
+            if ( scaled > magnitude_ )
+              PGBAR__UNLIKELY return pad_speed( buffer, _fixed_width + units_[3].size() )
+                << PGBAR__DEFAULT_SPEED << units_[3];
           }
 
-          return buffer << utils::format<utils::TxtLayout::Right>( fixed_len_speed(), std::move( orig ) );
+          // The scaled speed doesn't exceed the magnitude, so it takes at most 5 integer digits.
+          types::Char digits[16];
+          PGBAR__ASSERT( utils::format_size( scaled, 2 ) <= sizeof( digits ) );
+          const auto last = utils::format_to( digits, scaled, 2 );
+          return pad_speed( buffer, static_cast<types::Size>( last - digits ) + 1 + units_[nth_unit].size() )
+                   .append( digits, last )
+              << ' ' << units_[nth_unit];
         }
 
         PGBAR__NODISCARD PGBAR__FORCEINLINE constexpr types::Size fixed_len_speed() const noexcept
         {
           return _fixed_width + units_[nth_longest_unit_].width();
         }
+        // Right-align a speed of `length` bytes by writing the blanks before it.
+        PGBAR__FORCEINLINE io::CharPipeline& pad_speed( io::CharPipeline& buffer, types::Size length ) const
+        {
+          return length < fixed_len_speed() ? buffer.append( ' ', fixed_len_speed() - length ) : buffer;
+        }
 
       public:
         PGBAR__CXX20_CNSTXPR SpeedMeter() = default;
         PGBAR__NONEMPTY_COMPONENT( SpeedMeter, PGBAR__CXX20_CNSTXPR )
 
-#define PGBAR__METHOD( OptionName, ParamName, ReturnType )         \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ }; \
-  unpack( *this, option::OptionName( std::move( ParamName ) ) );   \
+#define PGBAR__METHOD( OptionName, ParamName, ReturnType )          \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ }; \
+  unpack( *this, option::OptionName( std::move( ParamName ) ) );    \
   return static_cast<ReturnType>( *this )
 
         /**
@@ -978,9 +1004,14 @@ namespace pgbar {
           if ( num_all_tasks == 0 )
             buffer << "-/-";
 
-          return buffer << utils::format<utils::TxtLayout::Right>( utils::count_digits( num_all_tasks ),
-                                                                   utils::format( num_task_done ) )
-                        << '/' << utils::format( num_all_tasks );
+          // Both numbers and the slash, each number taking at most 20 digits.
+          types::Char digits[std::numeric_limits<std::uint64_t>::digits10 * 2 + 3];
+          auto last = utils::format_to( digits, num_task_done );
+          *last++   = '/';
+          last      = utils::format_to( last, num_all_tasks );
+
+          const auto num_blank = utils::count_digits( num_all_tasks ) - utils::count_digits( num_task_done );
+          return buffer.append( ' ', num_blank ).append( digits, last );
         }
 
         PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX14_CNSTXPR std::uint32_t fixed_len_counter()
@@ -1002,11 +1033,8 @@ namespace pgbar {
             PGBAR__TRUST( num_time >= 0 );
             if ( num_time > 99 )
               return buffer.append( 'X', 2 );
-
-            auto ret = utils::format( num_time );
-            if ( ret.size() < 2 )
-              ret.insert( 0, 1, '0' );
-            return buffer << ret;
+            return buffer << static_cast<types::Char>( '0' + num_time / 10 )
+                          << static_cast<types::Char>( '0' + num_time % 10 );
           };
           const auto hours = std::chrono::duration_cast<std::chrono::hours>( duration );
           duration -= hours;
@@ -167,6 +167,25 @@ namespace pgbar {
         PGBAR__NODISCARD PGBAR__CXX20_CNSTXPR types::Size width() const noexcept { return width_; }
 
         PGBAR__CXX20_CNSTXPR const types::Char* data() const noexcept { return bytes_.data(); }
+        /**
+         * @return The number of bytes of the longest leading part of the string
+         * whose render width doesn't exceed `max_width`.
+         */
+        PGBAR__NODISCARD PGBAR__CXX20_CNSTXPR types::Size fit( types::Size max_width ) const
+        {
+          if ( max_width >= width_ )
+            return bytes_.size();
+          types::Size width = 0, i = 0;
+          while ( i < bytes_.size() ) {
+            const auto parsed = next_codepoint( bytes_.data() + i, bytes_.size() - i );
+            const auto glyph  = static_cast<types::Size>( glyph_width( parsed.first ) );
+            if ( width + glyph > max_width )
+              break;
+            width += glyph;
+            i += parsed.second;
+          }
+          return i;
+        }
         PGBAR__CXX20_CNSTXPR types::ROStr str() & noexcept { return bytes_; }
         PGBAR__CXX20_CNSTXPR types::ROStr str() const& noexcept { return bytes_; }
         PGBAR__CXX20_CNSTXPR types::String&& str() && noexcept { return std::move( bytes_ ); }
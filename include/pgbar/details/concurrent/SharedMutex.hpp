@@ -2,9 +2,10 @@
 #define PGBAR__SHAREDMUTEX
 
 #include "../core/Core.hpp"
+#include "../types/Types.hpp"
+#include <atomic>
+#include <mutex>
 #if !defined( __cpp_lib_shared_mutex )
-# include <atomic>
-# include <mutex>
 # include <thread>
 #else
 # include <shared_mutex>
@@ -89,6 +90,82 @@ namespace pgbar {
         }
       };
 #endif
+
+      /**
+       * A shared mutex that counts how many times the exclusive ownership is released,
+       * so the readers can tell whether the data it guards may have been modified since they last looked.
+       *
+       * The function registered by `observe` is called after every release of the exclusive ownership,
+       * for the readers that don't look unless they are told to.
+       */
+      class RevisedMutex final {
+        SharedMutex mtx_;
+        std::atomic<std::uint64_t> revision_;
+
+        static std::atomic<void ( * )()>& observer() noexcept
+        {
+          static std::atomic<void ( * )()> fn { nullptr };
+          return fn;
+        }
+        // The number of registrations that haven't been withdrawn, guarded by `registry()`.
+        static types::Size& num_observers() noexcept
+        {
+          static types::Size num = 0;
+          return num;
+        }
+        static std::mutex& registry() noexcept
+        {
+          static std::mutex mtx;
+          return mtx;
+        }
+
+      public:
+        RevisedMutex( const RevisedMutex& )              = delete;
+        RevisedMutex& operator=( const RevisedMutex& ) & = delete;
+
+        RevisedMutex() noexcept : revision_ { 0 } {}
+        ~RevisedMutex() = default;
+
+        PGBAR__FORCEINLINE void lock() & noexcept { mtx_.lock(); }
+        PGBAR__FORCEINLINE bool try_lock() & noexcept { return mtx_.try_lock(); }
+        PGBAR__FORCEINLINE void unlock() & noexcept
+        {
+          // Sequentially consistent, so the observer can't miss a revision that a reader has missed.
+          revision_.fetch_add( 1, std::memory_order_seq_cst );
+          mtx_.unlock();
+          if ( const auto fn = observer().load( std::memory_order_acquire ) )
+            fn();
+        }
+
+        PGBAR__FORCEINLINE void lock_shared() & noexcept { mtx_.lock_shared(); }
+        PGBAR__FORCEINLINE bool try_lock_shared() & noexcept { return mtx_.try_lock_shared(); }
+        PGBAR__FORCEINLINE void unlock_shared() & noexcept { mtx_.unlock_shared(); }
+
+        PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t revision() const noexcept
+        {
+          return revision_.load( std::memory_order_acquire );
+        }
+
+        /**
+         * Register a function to be called after each revision; it must not block or throw.
+
+         * Each registration is withdrawn by one call to `unobserve`, and the last function registered
+         * stays in effect until every registration has been withdrawn.
+         */
+        static void observe( void ( *fn )() ) noexcept
+        {
+          std::lock_guard<std::mutex> lock { registry() };
+          ++num_observers();
+          observer().store( fn, std::memory_order_release );
+        }
+        static void unobserve() noexcept
+        {
+          std::lock_guard<std::mutex> lock { registry() };
+          PGBAR__ASSERT( num_observers() > 0 );
+          if ( --num_observers() == 0 )
+            observer().store( nullptr, std::memory_order_release );
+        }
+      };
     }
   } // namespace _details
 } // namespace pgbar
@@ -0,0 +1,145 @@
+#ifndef PGBAR__STRIPEDCOUNTER
+#define PGBAR__STRIPEDCOUNTER
+
+#include "../core/Core.hpp"
+#include "../types/Types.hpp"
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+
+namespace pgbar {
+  namespace _details {
+    namespace concurrent {
+      /**
+       * A counter whose increments are spread over several cache-line-isolated slots,
+       * so that threads ticking concurrently do not keep bouncing the same cache line.
+
+       * Each thread accumulates into its own slot, and hands the accumulated amount back to the caller
+       * once it reaches the stride; the caller is responsible for publishing it to the shared counter.
+       * After `disengage()`, every increment is handed back immediately.
+       */
+      class StripedCounter final {
+        static constexpr types::Size _cacheline = 64;
+
+        struct alignas( _cacheline ) Slot {
+          std::atomic<std::uint64_t> value_;
+        };
+
+#ifdef __cpp_aligned_new
+        std::unique_ptr<Slot[]> slots_;
+#else
+        // Before C++17 `new` ignores the alignment of the slots, so they are placed by hand.
+        std::unique_ptr<types::Byte[]> storage_;
+        Slot* slots_;
+#endif
+        types::Size num_slots_;
+        std::atomic<std::uint64_t> stride_;
+
+        // Assign a stable, round-robin slot index to the calling thread.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE types::Size local_index() noexcept
+        {
+          static std::atomic<types::Size> sequence { 0 };
+          static thread_local types::Size index = 0;
+          if ( index == 0 )
+            PGBAR__UNLIKELY index = sequence.fetch_add( 1, std::memory_order_relaxed ) + 1;
+          return index;
+        }
+
+      public:
+        // The number of slots that would be useful on this machine, which is always a power of two.
+        PGBAR__NODISCARD static types::Size concurrency() noexcept
+        {
+          const auto hint = std::thread::hardware_concurrency();
+          types::Size num = 1;
+          while ( num < hint && num < 64 )
+            num <<= 1;
+          return num;
+        }
+
+        StripedCounter( const StripedCounter& )              = delete;
+        StripedCounter& operator=( const StripedCounter& ) & = delete;
+
+#ifdef __cpp_aligned_new
+        StripedCounter() noexcept : num_slots_ { 0 }, stride_ { 1 } {}
+#else
+        StripedCounter() noexcept : slots_ { nullptr }, num_slots_ { 0 }, stride_ { 1 } {}
+#endif
+        ~StripedCounter() = default;
+
+        // Clear all slots and start accumulating up to `stride` increments per slot.
+        // Not thread-safe; it must happen-before any concurrent call to `add()`.
+        void engage( types::Size num_slots, std::uint64_t stride ) & noexcept( false )
+        {
+          PGBAR__TRUST( num_slots > 0 && ( num_slots & ( num_slots - 1 ) ) == 0 );
+          PGBAR__TRUST( stride > 0 );
+          if ( num_slots_ != num_slots ) {
+#ifdef __cpp_aligned_new
+            slots_.reset( new Slot[num_slots] );
+#else
+            auto space = num_slots * sizeof( Slot ) + alignof( Slot ) - 1;
+            storage_.reset( new types::Byte[space] );
+            void* origin = storage_.get();
+            slots_ = static_cast<Slot*>(
+              std::align( alignof( Slot ), num_slots * sizeof( Slot ), origin, space ) );
+            PGBAR__TRUST( slots_ != nullptr );
+            for ( types::Size i = 0; i < num_slots; ++i )
+              new ( slots_ + i ) Slot();
+#endif
+            num_slots_ = num_slots;
+          }
+          for ( types::Size i = 0; i < num_slots_; ++i )
+            slots_[i].value_.store( 0, std::memory_order_relaxed );
+          stride_.store( stride, std::memory_order_relaxed );
+        }
+        // Stop accumulating, and return the amount collected from every slot.
+        PGBAR__NOINLINE std::uint64_t disengage() noexcept
+        {
+          if ( stride_.load( std::memory_order_relaxed ) <= 1 )
+            return 0;
+          /* Paired with the fetch_add-then-load sequence in `add()`:
+           * an increment that missed the sweep below is guaranteed to observe the new stride. */
+          stride_.store( 1, std::memory_order_seq_cst );
+          std::uint64_t collected = 0;
+          for ( types::Size i = 0; i < num_slots_; ++i )
+            collected += slots_[i].value_.exchange( 0, std::memory_order_seq_cst );
+          return collected;
+        }
+
+        // Whether the increments are still accumulated in the slots; if not, they go to the caller directly.
+        PGBAR__NODISCARD PGBAR__FORCEINLINE bool engaged() const noexcept
+        {
+          return stride_.load( std::memory_order_relaxed ) > 1;
+        }
+
+        // Return the amount that must be published by the caller, zero if there's nothing to do.
+        PGBAR__FORCEINLINE std::uint64_t add() noexcept
+        {
+          PGBAR__ASSERT( num_slots_ != 0 );
+          auto& slot         = slots_[local_index() & ( num_slots_ - 1 )].value_;
+          const auto pending = slot.fetch_add( 1, std::memory_order_seq_cst ) + 1;
+          if ( pending < stride_.load( std::memory_order_seq_cst ) )
+            return 0;
+          return slot.exchange( 0, std::memory_order_acq_rel );
+        }
+
+        // The upper bound of the amount that may be held by all slots at the same time.
+        PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t reserve() const noexcept
+        {
+          const auto stride = stride_.load( std::memory_order_relaxed );
+          return stride <= 1 ? 0 : num_slots_ * stride * 2;
+        }
+        // The amount currently held by all slots, which may be slightly outdated.
+        PGBAR__NODISCARD std::uint64_t pending() const noexcept
+        {
+          std::uint64_t total = 0;
+          for ( types::Size i = 0; i < num_slots_; ++i )
+            total += slots_[i].value_.load( std::memory_order_acquire );
+          return total;
+        }
+      };
+    } // namespace concurrent
+  } // namespace _details
+} // namespace pgbar
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef PGBAR__TASKSPLITTER
+#define PGBAR__TASKSPLITTER
+
+#include "../core/Core.hpp"
+#include "../types/Types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+
+namespace pgbar {
+  namespace _details {
+    namespace concurrent {
+      /**
+       * Split the index interval [0, total) among several workers,
+       * and let the workers that run out of indices steal from the others.
+
+       * Each worker takes chunks of at most `grain` indices from the front of its own interval;
+       * a worker whose interval is exhausted steals the back half of another worker's interval.
+       */
+      class TaskSplitter final {
+        static constexpr types::Size _cacheline = 64;
+
+        struct alignas( _cacheline ) Interval {
+          std::mutex mtx_;
+          std::uint64_t begin_, end_;
+        };
+
+#ifdef __cpp_aligned_new
+        std::unique_ptr<Interval[]> intervals_;
+#else
+        // Before C++17 `new` ignores the alignment of the intervals, so they are placed by hand.
+        std::unique_ptr<types::Byte[]> storage_;
+        Interval* intervals_;
+#endif
+        types::Size num_workers_;
+        std::uint64_t grain_;
+        std::atomic<bool> cancelled_;
+
+        PGBAR__NOINLINE bool steal( types::Size worker, std::uint64_t& first, std::uint64_t& last ) & noexcept
+        {
+          for ( types::Size i = 1; i < num_workers_; ++i ) {
+            auto& victim = intervals_[( worker + i ) % num_workers_];
+            std::uint64_t begin, end;
+            {
+              std::lock_guard<std::mutex> lock { victim.mtx_ };
+              const auto remains = victim.end_ - victim.begin_;
+              if ( remains == 0 )
+                continue;
+              // The front half is left to the victim, which is working right before it.
+              end         = victim.end_;
+              begin       = end - ( remains + 1 ) / 2;
+              victim.end_ = begin;
+            }
+            first = begin;
+            last  = first + (std::min)( grain_, end - begin );
+            if ( last != end ) {
+              // The own interval is empty here, so no thief can be touching it.
+              auto& own = intervals_[worker];
+              std::lock_guard<std::mutex> lock { own.mtx_ };
+              own.begin_ = last;
+              own.end_   = end;
+            }
+            return true;
+          }
+          return false;
+        }
+
+      public:
+        TaskSplitter( const TaskSplitter& )              = delete;
+        TaskSplitter& operator=( const TaskSplitter& ) & = delete;
+
+        TaskSplitter( types::Size num_workers, std::uint64_t total, std::uint64_t grain ) noexcept( false )
+#ifdef __cpp_aligned_new
+          : intervals_ { new Interval[num_workers] }
+#else
+          : intervals_ { nullptr }
+#endif
+          , num_workers_ { num_workers }
+          , grain_ { grain }
+          , cancelled_ { false }
+        {
+          PGBAR__TRUST( num_workers > 0 );
+          PGBAR__TRUST( grain > 0 );
+#ifndef __cpp_aligned_new
+          auto space = num_workers * sizeof( Interval ) + alignof( Interval ) - 1;
+          storage_.reset( new types::Byte[space] );
+          void* origin = storage_.get();
+          intervals_   = static_cast<Interval*>(
+            std::align( alignof( Interval ), num_workers * sizeof( Interval ), origin, space ) );
+          PGBAR__TRUST( intervals_ != nullptr );
+          for ( types::Size i = 0; i < num_workers; ++i )
+            new ( intervals_ + i ) Interval();
+#endif
+          const auto base = total / num_workers_, extra = total % num_workers_;
+          for ( types::Size i = 0; i < num_workers_; ++i ) {
+            intervals_[i].begin_ = base * i + (std::min)( static_cast<std::uint64_t>( i ), extra );
+            intervals_[i].end_   = intervals_[i].begin_ + base + ( i < extra );
+          }
+        }
+#ifdef __cpp_aligned_new
+        ~TaskSplitter() = default;
+#else
+        ~TaskSplitter()
+        {
+          for ( types::Size i = 0; i < num_workers_; ++i )
+            intervals_[i].~Interval();
+        }
+#endif
+
+        // Fetch the next chunk [first, last) for the worker, return false if there's nothing left.
+        PGBAR__NODISCARD bool next( types::Size worker, std::uint64_t& first, std::uint64_t& last ) & noexcept
+        {
+          PGBAR__TRUST( worker < num_workers_ );
+          if ( cancelled_.load( std::memory_order_relaxed ) )
+            PGBAR__UNLIKELY return false;
+          {
+            auto& own = intervals_[worker];
+            std::lock_guard<std::mutex> lock { own.mtx_ };
+            if ( own.begin_ != own.end_ ) {
+              first      = own.begin_;
+              last       = first + (std::min)( grain_, own.end_ - own.begin_ );
+              own.begin_ = last;
+              return true;
+            }
+          }
+          return steal( worker, first, last );
+        }
+
+        // Make every following `next()` return false.
+        void cancel() noexcept { cancelled_.store( true, std::memory_order_relaxed ); }
+      };
+    } // namespace concurrent
+  } // namespace _details
+} // namespace pgbar
+
+#endif
@@ -1,18 +1,24 @@
 #ifndef PGBAR__TERMCONTEXT
 #define PGBAR__TERMCONTEXT
 
+#include "../../sink/Sink.hpp"
 #include "../core/Core.hpp"
 #include "../types/Types.hpp"
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #if PGBAR__WIN
-# include <mutex>
 # ifndef NOMINMAX
 #  define NOMINMAX 1
 # endif
 # include <windows.h>
 #else
-# include <sys/ioctl.h>
 # include <unistd.h>
+# if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+#  include <signal.h>
+# endif
 #endif
 
 namespace pgbar {
@@ -21,14 +27,96 @@ namespace pgbar {
       template<Channel Outlet>
       class TermContext {
         std::atomic<bool> cache_;
+        // Checked before `sink_`, so the standard streams don't pay for the lock.
+        std::atomic<bool> redirected_;
+        mutable std::mutex sink_mtx_;
+        std::shared_ptr<sink::Sink> sink_;
+        /* The width of the terminal, read again once `requery_interval()` has passed since `queried_`,
+         * or only after the terminal has been resized if the resizes are tracked. */
+        std::atomic<std::uint16_t> columns_;
+        std::atomic<bool> stale_;
+        std::atomic<std::int64_t> queried_;
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+        // Bumped by every `SIGWINCH`, and `seen_` is the value that `columns_` was read at.
+        static std::atomic<std::uint32_t> _resized;
+        static struct sigaction _prev_action;
+        std::atomic<std::uint32_t> seen_;
+        // Whether the `SIGWINCH` handler is installed, which only happens on request.
+        std::atomic<bool> tracking_;
+        std::mutex track_mtx_;
 
-        TermContext() noexcept { detect(); }
+        static void on_resize( int signo, siginfo_t* info, void* context ) noexcept
+        {
+          _resized.fetch_add( 1, std::memory_order_relaxed );
+          // Pass the signal on to the handler installed before, if there's one.
+          if ( _prev_action.sa_flags & SA_SIGINFO ) {
+            if ( _prev_action.sa_sigaction != nullptr )
+              _prev_action.sa_sigaction( signo, info, context );
+          } else if ( _prev_action.sa_handler != SIG_DFL && _prev_action.sa_handler != SIG_IGN )
+            _prev_action.sa_handler( signo );
+        }
+        // Put the previous handler back, unless someone else has replaced ours since; return true on success.
+        static bool restore() noexcept
+        {
+          struct sigaction current {};
+          return sigaction( SIGWINCH, nullptr, &current ) == 0 && ( current.sa_flags & SA_SIGINFO )
+              && current.sa_sigaction == &on_resize && sigaction( SIGWINCH, &_prev_action, nullptr ) == 0;
+        }
+#endif
+
+        // How long the width of an untracked terminal is trusted before it's read again.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE TimeGranule requery_interval() noexcept
+        {
+          return std::chrono::milliseconds( 250 );
+        }
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE std::int64_t stamp() noexcept
+        {
+          const auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+          return std::chrono::duration_cast<TimeGranule>( since_epoch ).count();
+        }
+
+        TermContext() noexcept : redirected_ { false }, columns_ { 0 }, stale_ { true }, queried_ { 0 }
+        {
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+          seen_.store( _resized.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+          tracking_.store( false, std::memory_order_relaxed );
+#endif
+          detect();
+        }
+
+        // Query the width of the output stream from the system every time.
+        PGBAR__NODISCARD std::uint16_t query() const noexcept
+        {
+          if ( const auto target = sink() )
+            return target->width();
+#if PGBAR__WIN
+          HANDLE h_con;
+          if PGBAR__CXX17_CNSTXPR ( Outlet == Channel::Stdout )
+            h_con = GetStdHandle( STD_OUTPUT_HANDLE );
+          else
+            h_con = GetStdHandle( STD_ERROR_HANDLE );
+          if ( h_con != INVALID_HANDLE_VALUE ) {
+            CONSOLE_SCREEN_BUFFER_INFO csbi;
+            if ( GetConsoleScreenBufferInfo( h_con, &csbi ) )
+              return csbi.srWindow.Right - csbi.srWindow.Left + 1;
+          }
+#elif PGBAR__UNIX
+          return io::columns( static_cast<int>( Outlet ) );
+#endif
+          return 0;
+        }
 
       public:
         TermContext( const TermContext& )              = delete;
         TermContext& operator=( const TermContext& ) & = delete;
 
-        ~TermContext() = default;
+        ~TermContext() noexcept
+        {
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+          if ( tracking_.load( std::memory_order_acquire ) )
+            (void)restore();
+#endif
+        }
 
         static TermContext& itself() noexcept
         {
@@ -36,10 +124,31 @@ namespace pgbar {
           return self;
         }
 
+        // Write the output of the channel to `target` rather than the standard stream, if it isn't null.
+        void redirect( std::shared_ptr<sink::Sink> target ) noexcept
+        {
+          {
+            std::lock_guard<std::mutex> lock { sink_mtx_ };
+            sink_.swap( target );
+            redirected_.store( sink_ != nullptr, std::memory_order_release );
+          }
+          stale_.store( true, std::memory_order_relaxed );
+          detect();
+        }
+        // The sink that the channel is redirected to, or null if it writes to the standard stream.
+        PGBAR__NODISCARD std::shared_ptr<sink::Sink> sink() const noexcept
+        {
+          if ( !redirected_.load( std::memory_order_acquire ) )
+            return nullptr;
+          std::lock_guard<std::mutex> lock { sink_mtx_ };
+          return sink_;
+        }
+
         // Detect whether the specified output stream is bound to a terminal.
         bool detect() noexcept
         {
-          const bool value = []() noexcept {
+          const auto target = sink();
+          const bool value  = target != nullptr ? target->tty() : []() noexcept {
 #if defined( PGBAR_INTTY ) || PGBAR__UNKNOWN
             return true;
 #elif PGBAR__WIN
@@ -86,30 +195,86 @@ namespace pgbar {
 #endif
         }
 
-        PGBAR__NODISCARD std::uint16_t width() noexcept
+        /**
+         * Install a `SIGWINCH` handler that calls the one installed before it, if `flag` is true,
+         * so the width of the standard stream is read again only once the terminal has been resized;
+         * otherwise put the previous handler back, which only works while ours is the latest one.
+
+         * It does nothing on platforms other than unix-like ones, or if `PGBAR_NOWINCH` is defined.
+         */
+        void track_resize( bool flag ) noexcept
+        {
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+          std::lock_guard<std::mutex> lock { track_mtx_ };
+          if ( tracking_.load( std::memory_order_relaxed ) == flag )
+            return;
+          if ( flag ) {
+            struct sigaction action {};
+            action.sa_sigaction = &on_resize;
+            action.sa_flags     = SA_SIGINFO | SA_RESTART;
+            sigemptyset( &action.sa_mask );
+            if ( sigaction( SIGWINCH, &action, &_prev_action ) != 0 )
+              PGBAR__UNLIKELY return;
+          } else if ( !restore() )
+            PGBAR__UNLIKELY return;
+          stale_.store( true, std::memory_order_relaxed );
+          tracking_.store( flag, std::memory_order_release );
+#else
+          (void)flag;
+#endif
+        }
+        PGBAR__NODISCARD bool track_resize() const noexcept
+        {
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+          return tracking_.load( std::memory_order_acquire );
+#else
+          return false;
+#endif
+        }
+
+        PGBAR__NODISCARD std::uint16_t width() noexcept { return detect() ? query() : 0; }
+        /**
+         * The width of the terminal used to lay out the frames, or zero if it isn't a terminal.
+         *
+         * The width of the standard streams is cached and read again every `requery_interval()`,
+         * or only after a `SIGWINCH` while `track_resize` is on; while sinks are always asked for it.
+         */
+        PGBAR__NODISCARD std::uint16_t columns() noexcept
         {
-          if ( !detect() )
+          if ( !connected() )
             return 0;
-#if PGBAR__WIN
-          HANDLE h_con;
-          if PGBAR__CXX17_CNSTXPR ( Outlet == Channel::Stdout )
-            h_con = GetStdHandle( STD_OUTPUT_HANDLE );
-          else
-            h_con = GetStdHandle( STD_ERROR_HANDLE );
-          if ( h_con != INVALID_HANDLE_VALUE ) {
-            CONSOLE_SCREEN_BUFFER_INFO csbi;
-            if ( GetConsoleScreenBufferInfo( h_con, &csbi ) )
-              return csbi.srWindow.Right - csbi.srWindow.Left + 1;
+          if ( redirected_.load( std::memory_order_acquire ) )
+            return query();
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+          if ( tracking_.load( std::memory_order_acquire ) ) {
+            const auto generation = _resized.load( std::memory_order_relaxed );
+            if ( stale_.load( std::memory_order_relaxed )
+                 || generation != seen_.load( std::memory_order_relaxed ) ) {
+              // Mark it as seen before reading, so a resize in between is caught by the next call.
+              stale_.store( false, std::memory_order_relaxed );
+              seen_.store( generation, std::memory_order_relaxed );
+              columns_.store( query(), std::memory_order_relaxed );
+            }
+            return columns_.load( std::memory_order_relaxed );
           }
-#elif PGBAR__UNIX
-          struct winsize ws;
-          auto fd = static_cast<int>( Outlet );
-          if ( ioctl( fd, TIOCGWINSZ, &ws ) != -1 )
-            return ws.ws_col;
 #endif
-          return 0;
+          const auto now = stamp();
+          if ( stale_.load( std::memory_order_relaxed )
+               || TimeGranule( now - queried_.load( std::memory_order_relaxed ) ) >= requery_interval() ) {
+            stale_.store( false, std::memory_order_relaxed );
+            queried_.store( now, std::memory_order_relaxed );
+            columns_.store( query(), std::memory_order_relaxed );
+          }
+          return columns_.load( std::memory_order_relaxed );
         }
       };
+
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+      template<Channel Outlet>
+      std::atomic<std::uint32_t> TermContext<Outlet>::_resized { 0 };
+      template<Channel Outlet>
+      struct sigaction TermContext<Outlet>::_prev_action {};
+#endif
     } // namespace console
   } // namespace _details
 } // namespace pgbar
@@ -3,14 +3,69 @@
 
 #include "../charcodes/EncodedView.hpp"
 #include "../traits/Backport.hpp"
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace pgbar {
   namespace _details {
     namespace io {
       class CharPipeline {
+        // Append `num` copies of [first, last) with a single growth of the buffer.
+        PGBAR__CXX20_CNSTXPR void repeat( const types::Char* first,
+                                          const types::Char* last,
+                                          types::Size num ) &
+        {
+          const auto length = static_cast<types::Size>( last - first );
+          if ( num == 0 || length == 0 )
+            return;
+          // A single byte is filled by the standard library, which can do it in wide stores.
+          if ( length == 1 ) {
+            buffer_.insert( buffer_.end(), num, *first );
+            return;
+          }
+          const auto origin = buffer_.size();
+          buffer_.resize( origin + length * num );
+          const auto dest = buffer_.begin() + origin;
+          std::copy( first, last, dest );
+          // Keep doubling the copied part, so a long run costs a few block copies instead of `num`.
+          for ( auto copied = length, total = length * num; copied < total; copied *= 2 )
+            std::copy_n( dest, (std::min)( copied, total - copied ), dest + copied );
+        }
+
       protected:
+        // A run of bytes referenced by `refer`, which goes in front of `buffer_[offset_]`.
+        struct Segment {
+          const types::Char* data_;
+          types::Size size_;
+          types::Size offset_;
+        };
+        // The runs shorter than this are copied even in the scatter mode, as a reference costs about as much.
+        static constexpr types::Size _min_reference = 32;
+
         std::vector<types::Char> buffer_;
+        // Only used in the scatter mode, where `buffer_` holds the bytes between the segments.
+        std::vector<Segment> segments_;
+        std::vector<types::Char> spare_;
+        bool scatter_ = false;
+
+        // Copy the referenced segments into `buffer_`, so it holds the whole output again.
+        PGBAR__CXX20_CNSTXPR void gather() &
+        {
+          if ( segments_.empty() )
+            return;
+          spare_.clear();
+          spare_.reserve( size() );
+          types::Size offset = 0;
+          for ( const auto& segment : segments_ ) {
+            spare_.insert( spare_.end(), buffer_.cbegin() + offset, buffer_.cbegin() + segment.offset_ );
+            spare_.insert( spare_.end(), segment.data_, segment.data_ + segment.size_ );
+            offset = segment.offset_;
+          }
+          spare_.insert( spare_.end(), buffer_.cbegin() + offset, buffer_.cend() );
+          buffer_.swap( spare_ );
+          segments_.clear();
+        }
 
       public:
         PGBAR__CXX20_CNSTXPR CharPipeline() = default;
@@ -24,15 +79,34 @@ namespace pgbar {
 
         PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR bool empty() const noexcept
         {
-          return buffer_.empty();
+          return buffer_.empty() && segments_.empty();
+        }
+        // The number of bytes held, including the referenced ones.
+        PGBAR__NODISCARD PGBAR__CXX20_CNSTXPR types::Size size() const noexcept
+        {
+          types::Size total = buffer_.size();
+          for ( const auto& segment : segments_ )
+            total += segment.size_;
+          return total;
+        }
+        PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR void clear() & noexcept
+        {
+          buffer_.clear();
+          segments_.clear();
+        }
+        PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR types::Size capacity() const noexcept
+        {
+          return buffer_.capacity();
         }
-        PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR void clear() & noexcept { buffer_.clear(); }
 
         // Releases the buffer space completely
         PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR void release() noexcept
         {
           clear();
           buffer_.shrink_to_fit();
+          segments_.shrink_to_fit();
+          spare_.clear();
+          spare_.shrink_to_fit();
         }
 
         PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR CharPipeline& reserve( types::Size capacity ) &
@@ -50,12 +124,26 @@ namespace pgbar {
           buffer_.insert( buffer_.end(), first, last );
           return *this;
         }
+        /**
+         * Same as `append`, but the bytes in [first, last) must stay alive and unchanged until the output
+         * is cleared; then in the scatter mode, a long run of them is referenced in place instead of copied.
+         */
+        PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR CharPipeline& refer( const types::Char* first,
+                                                                     const types::Char* last ) &
+        {
+          PGBAR__TRUST( first <= last );
+          if ( !scatter_ || static_cast<types::Size>( last - first ) < _min_reference )
+            return append( first, last );
+          segments_.push_back( { first, static_cast<types::Size>( last - first ), buffer_.size() } );
+          return *this;
+        }
         template<types::Size N>
         PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR CharPipeline& append( const types::Char ( &info )[N],
                                                                       types::Size num = 1 ) &
         {
-          while ( num-- )
-            append( info, info + N );
+          static_assert( N > 0, "pgbar: expect a string literal" );
+          // The terminator of a string literal isn't part of the output, but the other bytes of an array are.
+          repeat( info, info + N - ( info[N - 1] == '\0' ? 1 : 0 ), num );
           return *this;
         }
         PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR CharPipeline& append( types::Char info,
@@ -67,8 +155,7 @@ namespace pgbar {
         PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR CharPipeline& append( types::ROStr info,
                                                                       types::Size num = 1 ) &
         {
-          while ( num-- )
-            append( info.data(), info.data() + info.size() );
+          repeat( info.data(), info.data() + info.size(), num );
           return *this;
         }
         PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR CharPipeline& append( const charcodes::U8Raw& info,
@@ -80,8 +167,7 @@ namespace pgbar {
                                                                       types::Size num = 1 ) &
         {
           if ( info )
-            while ( num-- )
-              append( info.begin(), info.end() );
+            repeat( info.begin(), info.end(), num );
           return *this;
         }
 
@@ -112,15 +198,17 @@ namespace pgbar {
         {
           PGBAR__TRUST( this != &other );
           buffer_.swap( other.buffer_ );
+          segments_.swap( other.segments_ );
+          std::swap( scatter_, other.scatter_ );
         }
         friend PGBAR__CXX20_CNSTXPR void swap( CharPipeline& a, CharPipeline& b ) noexcept { a.swap( b ); }
 
 #ifdef __cpp_lib_char8_t
         PGBAR__FORCEINLINE CharPipeline& append( types::LitU8 info, types::Size num = 1 ) &
         {
-          while ( num-- )
-            append( reinterpret_cast<const types::Char*>( info.data() ),
-                    reinterpret_cast<const types::Char*>( info.data() ) + info.size() );
+          repeat( reinterpret_cast<const types::Char*>( info.data() ),
+                  reinterpret_cast<const types::Char*>( info.data() ) + info.size(),
+                  num );
           return *this;
         }
         friend PGBAR__FORCEINLINE CharPipeline& operator<<( CharPipeline& stream, types::LitU8 info )
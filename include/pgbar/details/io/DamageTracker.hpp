@@ -0,0 +1,374 @@
+#ifndef PGBAR__DAMAGETRACKER
+#define PGBAR__DAMAGETRACKER
+
+#include "../charcodes/U8Raw.hpp"
+#include "../types/Types.hpp"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace pgbar {
+  namespace _details {
+    namespace io {
+      /**
+       * Rewrite each frame into the edits against the previous one, so only the changed cells are written.
+
+       * A frame is expected to be a head of cursor movements, followed by rows that are each terminated by
+       * a newline and may begin with a line wipe; a row itself only consists of glyphs and SGR sequences.
+       * A frame that doesn't fit, or whose head doesn't lead to the same rows as the previous one,
+       * is written as it is and becomes the new reference.
+       */
+      class DamageTracker {
+        // Every so often a frame is written in full, so any damage caused by other output doesn't stay.
+        static constexpr std::uint32_t _keyframe_period = 64;
+
+        struct Cell {
+          std::uint32_t begin_, end_; // the bytes of the glyph in `Row::glyphs_`
+          std::uint32_t style_;       // the index of the style in `Row::styles_`
+          std::uint32_t column_;
+          types::GlyphWidth width_;
+        };
+        // A run of `Row::sgrs_`.
+        struct Style {
+          std::uint32_t begin_, end_;
+        };
+        struct Row {
+          types::String glyphs_;
+          // The SGR sequences of the row in order, kept along with the row so their room is reused.
+          types::String sgrs_;
+          // The SGR sequences in effect since the last reset, each being a run of `sgrs_` that starts
+          // right after the reset; the first one is always empty.
+          std::vector<Style> styles_;
+          std::vector<Cell> cells_;
+          types::Size begin_, end_; // the bytes of the whole row in the frame, without the newline
+          std::uint32_t width_;
+          // Whether the row begins with a line wipe; if not, whatever was beyond it stays on the screen.
+          bool wiped_;
+
+          void clear() & noexcept
+          {
+            glyphs_.clear();
+            sgrs_.clear();
+            styles_.clear();
+            cells_.clear();
+            width_ = 0;
+            wiped_ = false;
+          }
+          PGBAR__NODISCARD bool same( const Style& mine,
+                                      const Row& other,
+                                      const Style& theirs ) const noexcept
+          {
+            const auto length = mine.end_ - mine.begin_;
+            return length == theirs.end_ - theirs.begin_
+                && sgrs_.compare( mine.begin_, length, other.sgrs_, theirs.begin_, length ) == 0;
+          }
+          PGBAR__NODISCARD bool same( const Cell& mine, const Row& other, const Cell& theirs ) const noexcept
+          {
+            const auto length = mine.end_ - mine.begin_;
+            return mine.column_ == theirs.column_ && mine.width_ == theirs.width_
+                && length == theirs.end_ - theirs.begin_
+                && glyphs_.compare( mine.begin_, length, other.glyphs_, theirs.begin_, length ) == 0
+                && same( styles_[mine.style_], other, other.styles_[theirs.style_] );
+          }
+        };
+
+        struct Head {
+          types::Size length_, num_prevline_;
+          bool restored_; // whether the cursor is moved back to the saved position
+        };
+
+        types::String head_;
+        std::vector<Row> shown_, drawn_;
+        types::Size num_shown_ = 0, num_drawn_ = 0;
+        std::uint32_t countdown_ = 0;
+        // Whether the terminal may be left in a style that isn't known, until the next SGR reset.
+        bool tainted_ = false;
+        std::vector<types::Char> edits_;
+
+        // Try to parse a CSI sequence at `pos`, return its length and final byte, or zero if it isn't one.
+        static std::pair<types::Size, types::Char> csi( const std::vector<types::Char>& frame,
+                                                        types::Size pos ) noexcept
+        {
+          if ( pos + 2 > frame.size() || frame[pos] != '\x1B' || frame[pos + 1] != '[' )
+            return { 0, '\0' };
+          for ( auto i = pos + 2; i < frame.size(); ++i ) {
+            const auto ch = frame[i];
+            if ( ( ch >= '0' && ch <= '9' ) || ch == ';' )
+              continue;
+            return { i + 1 - pos, ch };
+          }
+          return { 0, '\0' };
+        }
+
+        // Parse the cursor movements at the beginning of `frame`.
+        static Head parse_head( const std::vector<types::Char>& frame ) noexcept
+        {
+          Head head { 0, 0, false };
+          while ( head.length_ < frame.size() ) {
+            if ( frame[head.length_] == '\r' || frame[head.length_] == '\n' ) {
+              ++head.length_;
+              continue;
+            }
+            const auto seq = csi( frame, head.length_ );
+            if ( seq.first == 0 || ( seq.second != 'A' && seq.second != 's' && seq.second != 'u' ) )
+              break;
+            head.num_prevline_ += seq.second == 'A';
+            head.restored_ |= seq.second == 'u';
+            head.length_ += seq.first;
+          }
+          return head;
+        }
+
+        // Parse the rows starting at `pos` into `drawn_`, return false if the frame doesn't fit.
+        PGBAR__NODISCARD bool parse_rows( const std::vector<types::Char>& frame, types::Size pos ) &
+        {
+          bool tainted = tainted_;
+          num_drawn_   = 0;
+          while ( pos < frame.size() ) {
+            if ( num_drawn_ == drawn_.size() )
+              drawn_.emplace_back();
+            auto& row = drawn_[num_drawn_++];
+            row.clear();
+            row.styles_.push_back( { 0, 0 } );
+            row.begin_ = pos;
+
+            const auto wipe = csi( frame, pos );
+            if ( wipe.first != 0 && wipe.second == 'K' ) {
+              pos += wipe.first;
+              row.wiped_ = true;
+            }
+            while ( true ) {
+              if ( pos >= frame.size() )
+                return false; // a row must be terminated by a newline
+              const auto ch = static_cast<unsigned char>( frame[pos] );
+              if ( ch == '\n' ) {
+                // A style left over would leak into the rows after it.
+                if ( row.styles_.back().begin_ != row.styles_.back().end_ )
+                  return false;
+                break;
+              }
+              if ( ch == '\x1B' ) {
+                const auto seq = csi( frame, pos );
+                if ( seq.first == 0 || seq.second != 'm' )
+                  return false;
+                const auto begin = static_cast<std::uint32_t>( row.sgrs_.size() );
+                if ( seq.first == 3 || ( seq.first == 4 && frame[pos + 2] == '0' ) ) {
+                  row.styles_.push_back( { begin, begin } );
+                  tainted = false;
+                } else {
+                  // The new style is the one in effect with this sequence added to its end.
+                  row.sgrs_.append( frame.data() + pos, seq.first );
+                  row.styles_.push_back( { row.styles_.back().begin_ == row.styles_.back().end_
+                                             ? begin
+                                             : row.styles_.back().begin_,
+                                           static_cast<std::uint32_t>( row.sgrs_.size() ) } );
+                }
+                pos += seq.first;
+                continue;
+              }
+              if ( ch < 0x20 || ch == 0x7F )
+                return false;
+
+              types::Size length;
+              types::CodePoint codepoint;
+              if ( ch < 0x80 ) {
+                length    = 1;
+                codepoint = ch;
+              } else if ( ( ch & 0xE0 ) == 0xC0 ) {
+                length    = 2;
+                codepoint = ch & 0x1F;
+              } else if ( ( ch & 0xF0 ) == 0xE0 ) {
+                length    = 3;
+                codepoint = ch & 0x0F;
+              } else if ( ( ch & 0xF8 ) == 0xF0 ) {
+                length    = 4;
+                codepoint = ch & 0x07;
+              } else
+                return false;
+              if ( pos + length > frame.size() )
+                return false;
+              for ( types::Size i = 1; i < length; ++i )
+                codepoint = ( codepoint << 6 ) | ( static_cast<unsigned char>( frame[pos + i] ) & 0x3F );
+
+              const auto width = charcodes::U8Raw::glyph_width( codepoint );
+              const auto begin = static_cast<std::uint32_t>( row.glyphs_.size() );
+              row.glyphs_.append( frame.data() + pos, length );
+              if ( width == 0 ) {
+                // Combining marks belong to the glyph before them.
+                if ( row.cells_.empty() )
+                  return false;
+                row.cells_.back().end_ = static_cast<std::uint32_t>( row.glyphs_.size() );
+              } else {
+                row.cells_.push_back( { begin,
+                                        static_cast<std::uint32_t>( row.glyphs_.size() ),
+                                        static_cast<std::uint32_t>( row.styles_.size() - 1 ),
+                                        row.width_,
+                                        width } );
+                row.width_ += width;
+              }
+              pos += length;
+            }
+            row.end_ = pos++;
+          }
+          tainted_ = tainted;
+          return num_drawn_ > 0;
+        }
+
+        static void move_to( std::vector<types::Char>& out, std::uint32_t column )
+        {
+          types::Char digits[10];
+          types::Size num_digits = 0;
+          for ( auto number = column + 1; number != 0; number /= 10 )
+            digits[num_digits++] = static_cast<types::Char>( '0' + number % 10 );
+          out.push_back( '\x1B' );
+          out.push_back( '[' );
+          while ( num_digits != 0 )
+            out.push_back( digits[--num_digits] );
+          out.push_back( 'G' );
+        }
+
+        // Append the edits that turn `before` into `after` to `out`.
+        static void diff( std::vector<types::Char>& out, const Row& before, const Row& after )
+        {
+          const Style* style = nullptr;
+          bool styled        = false;
+          types::Size j      = 0;
+          for ( types::Size i = 0; i < after.cells_.size(); ) {
+            const auto& cell = after.cells_[i];
+            while ( j < before.cells_.size() && before.cells_[j].column_ < cell.column_ )
+              ++j;
+            if ( j < before.cells_.size() && after.same( cell, before, before.cells_[j] ) ) {
+              ++i;
+              continue;
+            }
+
+            move_to( out, cell.column_ );
+            style = nullptr;
+            // Write the run of the changed cells.
+            for ( ; i < after.cells_.size(); ++i ) {
+              const auto& changed = after.cells_[i];
+              while ( j < before.cells_.size() && before.cells_[j].column_ < changed.column_ )
+                ++j;
+              if ( j < before.cells_.size() && after.same( changed, before, before.cells_[j] ) )
+                break;
+              const auto& wanted = after.styles_[changed.style_];
+              if ( style == nullptr || !after.same( *style, after, wanted ) ) {
+                if ( styled || wanted.begin_ != wanted.end_ ) {
+                  out.insert( out.end(), { '\x1B', '[', '0', 'm' } );
+                  out.insert( out.end(),
+                              after.sgrs_.cbegin() + wanted.begin_,
+                              after.sgrs_.cbegin() + wanted.end_ );
+                }
+                styled = wanted.begin_ != wanted.end_;
+                style  = &wanted;
+              }
+              out.insert( out.end(),
+                          after.glyphs_.cbegin() + changed.begin_,
+                          after.glyphs_.cbegin() + changed.end_ );
+            }
+          }
+          if ( styled )
+            out.insert( out.end(), { '\x1B', '[', '0', 'm' } );
+          // The end of `before` isn't known if it wasn't wiped.
+          if ( after.wiped_ && ( !before.wiped_ || after.width_ < before.width_ ) ) {
+            move_to( out, after.width_ );
+            out.insert( out.end(), { '\x1B', '[', 'K' } );
+          }
+        }
+
+      public:
+        PGBAR__CXX20_CNSTXPR DamageTracker() = default;
+
+        // Forget the previous frame, the next one will be written in full.
+        void reset() & noexcept
+        {
+          head_.clear();
+          num_shown_ = 0;
+        }
+        // The rewritten frame takes the place of the original one, so it needs the same room.
+        void reserve( types::Size capacity ) & { edits_.reserve( capacity ); }
+        void release() noexcept
+        {
+          reset();
+          shown_.clear();
+          shown_.shrink_to_fit();
+          drawn_.clear();
+          drawn_.shrink_to_fit();
+          edits_.clear();
+          edits_.shrink_to_fit();
+        }
+
+        /**
+         * Whether writing `fresh` alone leaves the same rows on the screen as writing `stale` before it,
+         * that is both frames go back to the same place and redraw all the rows they write.
+         */
+        PGBAR__NODISCARD static bool supersedes( const std::vector<types::Char>& stale,
+                                                 const std::vector<types::Char>& fresh ) noexcept
+        {
+          const auto head = parse_head( fresh );
+          if ( stale.empty() || fresh.empty() || stale.back() != '\n' || fresh.back() != '\n'
+               || parse_head( stale ).length_ != head.length_
+               || !std::equal( fresh.cbegin(), fresh.cbegin() + head.length_, stale.cbegin() ) )
+            return false;
+          const auto num_rows = std::count( fresh.cbegin() + head.length_, fresh.cend(), '\n' );
+          return num_rows == std::count( stale.cbegin() + head.length_, stale.cend(), '\n' )
+              && ( head.restored_ || head.num_prevline_ == static_cast<types::Size>( num_rows ) );
+        }
+
+        /**
+         * Replace `frame` with the edits against the previous frame if that's shorter;
+         * `frame` is left empty if nothing has changed.
+         */
+        void rewrite( std::vector<types::Char>& frame ) &
+        {
+          const auto head    = parse_head( frame );
+          const auto pos     = head.length_;
+          const bool tainted = tainted_;
+          if ( !parse_rows( frame, pos ) ) {
+            reset();
+            tainted_ = true;
+            return;
+          }
+          if ( tainted ) {
+            // Some cells of this frame may be shown in a leftover style, so it can't be the reference.
+            reset();
+            return;
+          }
+          /* Row `i` of this frame lands on the row `i` of the previous one only if both start from the same
+           * place: either the same saved position, or right above the rows written last time. */
+          const bool aligned = num_shown_ == num_drawn_ && countdown_ != 0
+                            && head_.size() == pos && head_.compare( 0, pos, frame.data(), pos ) == 0
+                            && ( head.restored_ || head.num_prevline_ == num_shown_ );
+          head_.assign( frame.data(), pos );
+          if ( aligned ) {
+            --countdown_;
+            edits_.clear();
+            edits_.insert( edits_.end(), frame.cbegin(), frame.cbegin() + pos );
+            bool changed = false;
+            for ( types::Size i = 0; i < num_drawn_; ++i ) {
+              const auto& row  = drawn_[i];
+              const auto start = edits_.size();
+              diff( edits_, shown_[i], row );
+              changed |= edits_.size() != start;
+              if ( edits_.size() - start >= row.end_ - row.begin_ ) {
+                edits_.resize( start );
+                edits_.insert( edits_.end(), frame.cbegin() + row.begin_, frame.cbegin() + row.end_ );
+              }
+              edits_.push_back( '\n' );
+            }
+            if ( changed )
+              frame.swap( edits_ );
+            else
+              frame.clear();
+          } else
+            countdown_ = _keyframe_period;
+
+          shown_.swap( drawn_ );
+          num_shown_ = num_drawn_;
+        }
+      };
+    } // namespace io
+  } // namespace _details
+} // namespace pgbar
+
+#endif
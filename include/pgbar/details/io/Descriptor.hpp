@@ -0,0 +1,125 @@
+#ifndef PGBAR__DESCRIPTOR
+#define PGBAR__DESCRIPTOR
+
+#include "../../exception/Error.hpp"
+#include "../core/Core.hpp"
+#include "../types/Types.hpp"
+#include <cerrno>
+#if PGBAR__WIN
+# include <io.h>
+#elif PGBAR__UNIX
+# include <climits>
+# include <poll.h>
+# include <sys/ioctl.h>
+# include <sys/uio.h>
+# include <unistd.h>
+#endif
+
+namespace pgbar {
+  namespace _details {
+    namespace io {
+#if PGBAR__WIN || PGBAR__UNIX
+      // Write all the bytes to the file descriptor `fd`.
+      inline void write_all( int fd, const types::Char* data, types::Size size ) noexcept( false )
+      {
+        types::Size total_written = 0;
+        while ( total_written < size ) {
+# if PGBAR__WIN
+          const auto num_written = _write( fd,
+                                           data + total_written,
+                                           static_cast<unsigned int>( size - total_written ) );
+# else
+          const auto num_written = write( fd, data + total_written, size - total_written );
+# endif
+          if ( num_written < 0 ) {
+            if ( errno == EINTR )
+              continue;
+            PGBAR__UNLIKELY throw exception::SystemError(
+              std::error_code( errno, std::generic_category() ),
+              charcodes::make_literal( "pgbar: write to output stream failed" ) );
+          }
+          total_written += static_cast<types::Size>( num_written );
+        }
+      }
+
+# if PGBAR__UNIX
+      /**
+       * Write all the bytes referenced by `count` buffers to `fd`, gathered by as few `writev` calls as possible.
+       * The buffers are consumed in place as they are written.
+       */
+      inline void write_all( int fd, struct iovec* iov, types::Size count ) noexcept( false )
+      {
+#  ifdef IOV_MAX
+        constexpr types::Size max_batch = IOV_MAX;
+#  else
+        constexpr types::Size max_batch = 16; // the least that POSIX allows
+#  endif
+        while ( count != 0 ) {
+          const auto num_written =
+            writev( fd, iov, static_cast<int>( count < max_batch ? count : max_batch ) );
+          if ( num_written < 0 ) {
+            if ( errno == EINTR )
+              continue;
+            PGBAR__UNLIKELY throw exception::SystemError(
+              std::error_code( errno, std::generic_category() ),
+              charcodes::make_literal( "pgbar: write to output stream failed" ) );
+          }
+          // Skip the buffers written in full, and resume from the middle of a partially written one.
+          auto remains = static_cast<types::Size>( num_written );
+          while ( count != 0 && remains >= iov->iov_len ) {
+            remains -= iov->iov_len;
+            ++iov;
+            --count;
+          }
+          if ( count != 0 ) {
+            iov->iov_base = static_cast<char*>( iov->iov_base ) + remains;
+            iov->iov_len -= remains;
+          }
+        }
+      }
+# endif
+
+      // Whether the file descriptor `fd` is bound to a terminal.
+      PGBAR__NODISCARD inline bool is_terminal( int fd ) noexcept
+      {
+# if PGBAR__WIN
+        return _isatty( fd ) != 0;
+# else
+        return isatty( fd ) != 0;
+# endif
+      }
+
+      // The width of the terminal bound to `fd`, or zero if it isn't known.
+      PGBAR__NODISCARD inline std::uint16_t columns( int fd ) noexcept
+      {
+# if PGBAR__UNIX
+        struct winsize ws;
+        if ( ioctl( fd, TIOCGWINSZ, &ws ) != -1 )
+          return ws.ws_col;
+# else
+        (void)fd;
+# endif
+        return 0;
+      }
+
+      // Whether `fd` hasn't taken what was written before, so the bytes written now would wait behind it.
+      PGBAR__NODISCARD inline bool lagging( int fd ) noexcept
+      {
+# if PGBAR__UNIX
+        pollfd target { fd, POLLOUT, 0 };
+        if ( poll( &target, 1, 0 ) == 0 )
+          return true;
+        // Bytes still queued by a terminal driver, which a pseudo terminal or a pipe may not report.
+        int num_queued = 0;
+        return ioctl( fd, TIOCOUTQ, &num_queued ) == 0 && num_queued > 0;
+# else
+        (void)fd;
+        return false;
+# endif
+      }
+#endif
+    } // namespace io
+  } // namespace _details
+} // namespace pgbar
+
+#endif
@@ -1,18 +1,28 @@
 #ifndef PGBAR__OSTREAM
 #define PGBAR__OSTREAM
 
+#include "../concurrent/ExceptionBox.hpp"
+#include "../console/TermContext.hpp"
+#include "../utils/ScopeGuard.hpp"
 #include "CharPipeline.hpp"
+#include "DamageTracker.hpp"
+#include "Descriptor.hpp"
+#include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #ifdef __cpp_lib_span
 # include <span>
 #endif
 #if PGBAR__WIN
-# include "../console/TermContext.hpp"
 # ifndef NOMINMAX
 #  define NOMINMAX 1
 # endif
 # include <windows.h>
 #elif PGBAR__UNIX
+# include <sys/uio.h>
 # include <unistd.h>
 #else
 # include <iostream>
@@ -29,9 +39,9 @@ namespace pgbar {
         return stream.flush();
       }
       template<Channel Outlet>
-      PGBAR__CXX20_CNSTXPR OStream<Outlet>& release( OStream<Outlet>& stream ) noexcept
+      PGBAR__CXX20_CNSTXPR OStream<Outlet>& reset( OStream<Outlet>& stream ) noexcept
       {
-        stream.release();
+        stream.reset();
         return stream;
       }
 
@@ -41,17 +51,232 @@ namespace pgbar {
        * It holds a proprietary buffer
        * so that don't have to use the common output buffers in the standard library.
        *
+       * The frames are written by a dedicated writer thread, so a slow terminal only holds up that thread;
+       * `flush` merely hands the frame over, and a frame that is still waiting to be written
+       * is replaced by the next one if the latter redraws the same rows.
+       * `External` progress bars, and `Sync` or `Throttle` ones while `writer_thread` is disabled,
+       * write on the thread that calls `flush` instead.
+       *
+       * When the thread that builds a frame also writes it straight to the file descriptor,
+       * the buffer is put in the scatter mode: the static bytes of the frame are referenced rather than copied,
+       * and the frame is written by a single `writev` on unix-like platforms.
+       *
        * If the local platform is neither `Windows` nor `unix-like`,
        * the class still uses the method `write` of `std::ostream` in standard library.
        */
       template<Channel Outlet>
       class OStream final : public CharPipeline {
+        static std::atomic<bool> _damage_tracking;
+        static std::atomic<bool> _backpressure;
+        static std::atomic<bool> _writer_thread;
+        // How often the writer checks a sink that is behind, in milliseconds.
+        static constexpr std::int64_t _backoff_period = 2;
+
+        // The bytes handed over by `flush` and not yet written.
+        std::vector<types::Char> pending_;
+        // Only accessed by the writer thread, or by others while the writer is idle.
+        std::vector<types::Char> front_;
+        DamageTracker tracker_;
+#if PGBAR__UNIX
+        std::vector<struct iovec> iovecs_;
+#endif
 #if PGBAR__WIN && !defined( PGBAR_UTF8 )
         std::vector<WCHAR> wb_buffer_;
         std::vector<types::Char> localized_;
 #endif
+        // The earliest error raised by the writer thread, rethrown by the next `flush`.
+        concurrent::ExceptionBox box_;
+        // The moving average of the time from taking a frame for writing until it's written.
+        std::atomic<TimeGranule> write_cost_;
+        // Whether the frames of the current progress bar go through the writer thread.
+        bool threaded_;
+        bool busy_, stop_;
+        std::thread writer_;
+        std::mutex io_mtx_;
+        std::condition_variable cond_var_;
+
+        OStream() noexcept
+          : write_cost_ { TimeGranule::zero() }, threaded_ { false }, busy_ { false }, stop_ { false }
+        {}
+
+        // Fold the time taken by the frame written since `start` into the moving average.
+        void measure( std::chrono::steady_clock::time_point start ) noexcept
+        {
+          const auto cost    = std::chrono::steady_clock::now() - start;
+          const auto average = write_cost_.load( std::memory_order_relaxed );
+          write_cost_.store( average + ( std::chrono::duration_cast<TimeGranule>( cost ) - average ) / 8,
+                             std::memory_order_relaxed );
+        }
+
+        void run() noexcept
+        {
+          std::unique_lock<std::mutex> lock { io_mtx_ };
+          while ( true ) {
+            cond_var_.wait( lock, [this]() noexcept { return !pending_.empty() || stop_; } );
+            // The writer doesn't leave until everything handed over is written.
+            if ( pending_.empty() )
+              return;
+            front_.swap( pending_ );
+            busy_ = true;
+            const auto start = std::chrono::steady_clock::now();
+            // Hold the frame back while the sink is behind, so a newer one can take its place.
+            while ( backpressure() && !stop_ && behind() ) {
+              cond_var_.wait_for( lock, std::chrono::milliseconds( _backoff_period ) );
+              if ( !pending_.empty() && replaceable( front_, pending_ ) ) {
+                front_.swap( pending_ );
+                pending_.clear();
+              }
+            }
+            lock.unlock();
+            try {
+              present( front_ );
+            } catch ( ... ) {
+              const auto stored = box_.try_store( std::current_exception() );
+              (void)stored; // only the earliest exception is kept
+            }
+            measure( start );
+            front_.clear();
+            lock.lock();
+            busy_ = false;
+            // Release the threads waiting in `reset` or `release`.
+            cond_var_.notify_all();
+          }
+        }
+
+        // Write the frame that `flush` held back on the calling thread, and wait for the writer thread.
+        void settle( std::unique_lock<std::mutex>& lock ) noexcept
+        {
+          PGBAR__TRUST( lock.owns_lock() );
+          if ( !threaded_ && !pending_.empty() ) {
+            front_.swap( pending_ );
+            try {
+              present( front_ );
+            } catch ( ... ) {
+              const auto stored = box_.try_store( std::current_exception() );
+              (void)stored;
+            }
+            front_.clear();
+          }
+          cond_var_.wait( lock, [this]() noexcept { return pending_.empty() && !busy_; } );
+        }
+
+        // Whether `fresh` can be written in place of `stale`, which hasn't been written yet.
+        PGBAR__NODISCARD static bool replaceable( const std::vector<types::Char>& stale,
+                                                  const std::vector<types::Char>& fresh ) noexcept
+        {
+          // The frames written to a file or a pipe are plain lines, any of them can be dropped.
+          if ( !console::TermContext<Outlet>::itself().connected() )
+            return backpressure();
+          return DamageTracker::supersedes( stale, fresh );
+        }
+
+        // Whether the sink hasn't taken what was written before, so a frame written now would wait behind it.
+        PGBAR__NODISCARD static bool behind() noexcept
+        {
+          if ( const auto target = console::TermContext<Outlet>::itself().sink() )
+            return target->behind();
+#if PGBAR__UNIX
+          return lagging( utils::to_underlying( Outlet ) );
+#else
+          return false;
+#endif
+        }
+
+        /**
+         * Whether the frame being built can be written from where its bytes are, without being copied together;
+         * that's when it's written by the calling thread to the file descriptor as it is.
+         */
+        PGBAR__NODISCARD bool direct() const noexcept
+        {
+#if PGBAR__UNIX
+          return !threaded_ && pending_.empty() && !backpressure()
+              && console::TermContext<Outlet>::itself().sink() == nullptr
+              && ( !console::TermContext<Outlet>::itself().connected() || !damage_tracking() );
+#else
+          return false;
+#endif
+        }
+#if PGBAR__UNIX
+        // Write the dynamic bytes in `buffer_` and the referenced segments in between by one `writev`.
+        void scatter() &
+        {
+          iovecs_.clear();
+          auto push = [this]( const types::Char* data, types::Size size ) {
+            if ( size != 0 )
+              iovecs_.push_back( { const_cast<types::Char*>( data ), size } );
+          };
+          types::Size offset = 0;
+          for ( const auto& segment : this->segments_ ) {
+            push( this->buffer_.data() + offset, segment.offset_ - offset );
+            push( segment.data_, segment.size_ );
+            offset = segment.offset_;
+          }
+          push( this->buffer_.data() + offset, this->buffer_.size() - offset );
+          write_all( utils::to_underlying( Outlet ), iovecs_.data(), iovecs_.size() );
+        }
+#endif
 
-        PGBAR__CXX20_CNSTXPR OStream() = default;
+        // Write the bytes of a frame that has been handed over.
+        void present( std::vector<types::Char>& bytes ) &
+        {
+          if ( console::TermContext<Outlet>::itself().connected() ) {
+            if ( damage_tracking() )
+              tracker_.rewrite( bytes );
+            else
+              tracker_.reset();
+            // The frame looks the same as the one on the screen.
+            if ( bytes.empty() )
+              return;
+          }
+          if ( const auto target = console::TermContext<Outlet>::itself().sink() ) {
+            target->write( bytes.data(), bytes.size() );
+            return;
+          }
+
+#if PGBAR__WIN && !defined( PGBAR_UTF8 )
+          if ( !console::TermContext<Outlet>::itself().connected() ) {
+            writeout( bytes );
+            return;
+          }
+          const auto codepage = GetConsoleOutputCP();
+          if ( codepage == CP_UTF8 ) {
+            writeout( bytes );
+            return;
+          }
+
+          // The target type char is not subject to strict alias restrictions.
+          const auto wlen = MultiByteToWideChar( CP_UTF8,
+                                                 0,
+                                                 reinterpret_cast<LPCCH>( bytes.data() ),
+                                                 static_cast<int>( bytes.size() ),
+                                                 nullptr,
+                                                 0 );
+          PGBAR__TRUST( wlen > 0 );
+          wb_buffer_.resize( static_cast<types::Size>( wlen ) );
+          MultiByteToWideChar( CP_UTF8,
+                               0,
+                               reinterpret_cast<LPCCH>( bytes.data() ),
+                               static_cast<int>( bytes.size() ),
+                               wb_buffer_.data(),
+                               wlen );
+
+          const auto mblen =
+            WideCharToMultiByte( codepage, 0, wb_buffer_.data(), wlen, nullptr, 0, nullptr, nullptr );
+          PGBAR__TRUST( mblen > 0 );
+          localized_.resize( static_cast<types::Size>( mblen ) );
+          WideCharToMultiByte( codepage,
+                               0,
+                               wb_buffer_.data(),
+                               wlen,
+                               reinterpret_cast<LPSTR>( localized_.data() ),
+                               mblen,
+                               nullptr,
+                               nullptr );
+          writeout( localized_ );
+#else
+          writeout( bytes );
+#endif
+        }
 
       public:
 #ifdef __cpp_lib_span
@@ -66,6 +291,43 @@ namespace pgbar {
           return instance;
         }
 
+        // Whether only the changed cells of a frame are written to the terminal.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE bool damage_tracking() noexcept
+        {
+          return _damage_tracking.load( std::memory_order_acquire );
+        }
+        static PGBAR__FORCEINLINE void damage_tracking( bool flag ) noexcept
+        {
+          _damage_tracking.store( flag, std::memory_order_release );
+        }
+        // Whether the frames waiting for a sink that is behind are dropped in favor of the newer ones.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE bool backpressure() noexcept
+        {
+          return _backpressure.load( std::memory_order_acquire );
+        }
+        static PGBAR__FORCEINLINE void backpressure( bool flag ) noexcept
+        {
+          _backpressure.store( flag, std::memory_order_release );
+        }
+        // Whether the frames of the `Sync` and `Throttle` progress bars are written by the writer thread.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE bool writer_thread() noexcept
+        {
+          return _writer_thread.load( std::memory_order_acquire );
+        }
+        static PGBAR__FORCEINLINE void writer_thread( bool flag ) noexcept
+        {
+          _writer_thread.store( flag, std::memory_order_release );
+        }
+
+        /**
+         * How long a frame takes to be written, averaged over the latest frames;
+         * on the writer thread, this includes the time a frame is held back by `backpressure`.
+         */
+        PGBAR__NODISCARD PGBAR__FORCEINLINE TimeGranule write_cost() const noexcept
+        {
+          return write_cost_.load( std::memory_order_relaxed );
+        }
+
         static PGBAR__FORCEINLINE void writeout( SinkBuffer bytes )
         {
 #if PGBAR__WIN
@@ -90,19 +352,7 @@ namespace pgbar {
             total_written += static_cast<types::Size>( num_written );
           } while ( total_written < bytes.size() );
 #elif PGBAR__UNIX
-          types::Size total_written = 0;
-          do {
-            ssize_t num_written = write( utils::to_underlying( Outlet ),
-                                         bytes.data() + total_written,
-                                         bytes.size() - total_written );
-            if ( errno == EINTR )
-              num_written = (std::max<ssize_t>)( 0, num_written );
-            else if ( num_written < 0 )
-              PGBAR__UNLIKELY throw exception::SystemError(
-                std::error_code( errno, std::generic_category() ),
-                charcodes::make_literal( "pgbar: write to output stream failed" ) );
-            total_written += static_cast<types::Size>( num_written );
-          } while ( total_written < bytes.size() );
+          write_all( utils::to_underlying( Outlet ), bytes.data(), bytes.size() );
 #else
           if PGBAR__CXX17_CNSTXPR ( Outlet == Channel::Stdout )
             std::cout.write( bytes.data(), bytes.size() ).flush();
@@ -111,80 +361,123 @@ namespace pgbar {
 #endif
         }
 
-        PGBAR__CXX20_CNSTXPR OStream( const OStream& )              = delete;
-        PGBAR__CXX20_CNSTXPR OStream& operator=( const OStream& ) & = delete;
+        OStream( const OStream& )              = delete;
+        OStream& operator=( const OStream& ) & = delete;
         // Intentional non-virtual destructors.
-        PGBAR__CXX20_CNSTXPR ~OStream()                             = default;
+        ~OStream() noexcept
+        {
+          {
+            std::lock_guard<std::mutex> lock { io_mtx_ };
+            stop_ = true;
+            cond_var_.notify_all();
+          }
+          if ( writer_.joinable() )
+            writer_.join();
+        }
 
-#if PGBAR__WIN && !defined( PGBAR_UTF8 )
-        PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR void release() noexcept
+        /**
+         * Wait until everything handed over is written, then drop what's left in the buffer;
+         * the buffer space is kept for the next progress bar.
+         */
+        void reset() noexcept
         {
+          std::unique_lock<std::mutex> lock { io_mtx_ };
+          settle( lock );
+          CharPipeline::clear();
+          tracker_.reset();
+          this->scatter_ = direct();
+        }
+        /**
+         * Make room for a frame of `capacity` bytes in every buffer that a frame goes through.
+         * This never waits for the writer thread, so the buffers it's writing from are left to grow
+         * by themselves if it's busy.
+         */
+        OStream& reserve( types::Size capacity ) &
+        {
+          std::lock_guard<std::mutex> lock { io_mtx_ };
+          CharPipeline::reserve( capacity );
+          this->spare_.reserve( capacity );
+          pending_.reserve( capacity );
+          if ( !busy_ ) {
+            front_.reserve( capacity );
+            tracker_.reserve( capacity );
+          }
+          return *this;
+        }
+        // Wait until everything handed over is written, then release the buffer space completely.
+        void release() noexcept
+        {
+          std::unique_lock<std::mutex> lock { io_mtx_ };
+          settle( lock );
           CharPipeline::release();
+          pending_.shrink_to_fit();
+          front_.shrink_to_fit();
+          tracker_.release();
+#if PGBAR__UNIX
+          iovecs_.clear();
+          iovecs_.shrink_to_fit();
+#endif
+#if PGBAR__WIN && !defined( PGBAR_UTF8 )
           wb_buffer_.clear();
           wb_buffer_.shrink_to_fit();
           localized_.clear();
           localized_.shrink_to_fit();
+#endif
         }
 
-        PGBAR__FORCEINLINE PGBAR__CXX20_CNSTXPR void clear() & noexcept
+        // Decide who writes the frames of a progress bar under `Mode`; called when the bar boots.
+        template<Policy Mode>
+        OStream& engage() & noexcept
         {
-          CharPipeline::clear();
-          wb_buffer_.clear();
-          localized_.clear();
+          std::lock_guard<std::mutex> lock { io_mtx_ };
+          // `poll()` promises that the frame has been written when it returns, so `External` writes inline.
+          threaded_ = Mode == Policy::Async || Mode == Policy::Signal
+                   || ( Mode != Policy::External && writer_thread() );
+          this->scatter_ = direct();
+          return *this;
         }
-#endif
 
+        // Write the frame in the buffer, or hand it over to the writer thread.
         OStream& flush() &
         {
-          if ( this->buffer_.empty() )
-            return *this;
-
-#if PGBAR__WIN && !defined( PGBAR_UTF8 )
-          if ( !console::TermContext<Outlet>::itself().connected() ) {
-            writeout( this->buffer_ );
-            CharPipeline::clear();
+          box_.rethrow();
+          if ( CharPipeline::empty() )
             return *this;
-          }
-          const auto codepage = GetConsoleOutputCP();
-          if ( codepage == CP_UTF8 ) {
-            writeout( this->buffer_ );
+          std::lock_guard<std::mutex> lock { io_mtx_ };
+#if PGBAR__UNIX
+          if ( !this->segments_.empty() && direct() ) {
+            auto guard = utils::make_scope_fail( [this]() noexcept { CharPipeline::clear(); } );
+            tracker_.reset();
+            const auto start = std::chrono::steady_clock::now();
+            scatter();
+            measure( start );
             CharPipeline::clear();
             return *this;
           }
-
-          // The target type char is not subject to strict alias restrictions.
-          const auto wlen = MultiByteToWideChar( CP_UTF8,
-                                                 0,
-                                                 reinterpret_cast<LPCCH>( buffer_.data() ),
-                                                 static_cast<int>( buffer_.size() ),
-                                                 nullptr,
-                                                 0 );
-          PGBAR__TRUST( wlen > 0 );
-          wb_buffer_.resize( static_cast<types::Size>( wlen ) );
-          MultiByteToWideChar( CP_UTF8,
-                               0,
-                               reinterpret_cast<LPCCH>( buffer_.data() ),
-                               static_cast<int>( buffer_.size() ),
-                               wb_buffer_.data(),
-                               wlen );
-
-          const auto mblen =
-            WideCharToMultiByte( codepage, 0, wb_buffer_.data(), wlen, nullptr, 0, nullptr, nullptr );
-          PGBAR__TRUST( mblen > 0 );
-          localized_.resize( static_cast<types::Size>( mblen ) );
-          WideCharToMultiByte( codepage,
-                               0,
-                               wb_buffer_.data(),
-                               wlen,
-                               reinterpret_cast<LPSTR>( localized_.data() ),
-                               mblen,
-                               nullptr,
-                               nullptr );
-          writeout( localized_ );
-#else
-          writeout( this->buffer_ );
 #endif
-          clear();
+          // The frame has to be handed over or be tracked as a whole.
+          this->gather();
+          if ( threaded_ && !writer_.joinable() )
+            writer_ = std::thread( [this]() noexcept { run(); } );
+          // Each flush carries exactly one frame, so a stale one can be dropped if the new one covers it.
+          if ( pending_.empty() || replaceable( pending_, this->buffer_ ) )
+            pending_.swap( this->buffer_ );
+          else
+            pending_.insert( pending_.end(), this->buffer_.cbegin(), this->buffer_.cend() );
+          CharPipeline::clear();
+
+          if ( threaded_ )
+            cond_var_.notify_all();
+          // Hold the frame back while the sink is behind, so the next flush or `reset` writes it instead.
+          else if ( !backpressure() || !behind() ) {
+            front_.swap( pending_ );
+            auto guard       = utils::make_scope_fail( [this]() noexcept { front_.clear(); } );
+            const auto start = std::chrono::steady_clock::now();
+            present( front_ );
+            measure( start );
+            front_.clear();
+          }
+          this->scatter_ = direct();
           return *this;
         }
 
@@ -195,6 +488,16 @@ namespace pgbar {
           return fnptr( stream );
         }
       };
+      template<Channel Outlet>
+      std::atomic<bool> OStream<Outlet>::_damage_tracking { true };
+      template<Channel Outlet>
+      std::atomic<bool> OStream<Outlet>::_backpressure { false };
+      template<Channel Outlet>
+      std::atomic<bool> OStream<Outlet>::_writer_thread { true };
+#if !PGBAR__CXX17
+      template<Channel Outlet>
+      constexpr std::int64_t OStream<Outlet>::_backoff_period;
+#endif
     } // namespace io
   } // namespace _details
 } // namespace pgbar
@@ -161,7 +161,7 @@ namespace pgbar {
           noexcept( traits::AllOf<std::is_nothrow_default_constructible<Base>,
                                   std::is_nothrow_copy_assignable<Base>>::value )
         {
-          std::lock_guard<concurrent::SharedMutex> lock { other.rw_mtx_ };
+          std::lock_guard<concurrent::RevisedMutex> lock { other.rw_mtx_ };
           // Here we are calling the operator= of Base, which is lock-free.
           Base::operator=( other );
           visual_masks_ = other.visual_masks_;
@@ -172,7 +172,7 @@ namespace pgbar {
           //   std::is_nothrow_default_constructible<Base>::value,
           //   "To ensure that the move ctor is strictly noexcept, "
           //   "it is necessary to require that the default constructor of the base class is noexcept." );
-          std::lock_guard<concurrent::SharedMutex> lock { rhs.rw_mtx_ };
+          std::lock_guard<concurrent::RevisedMutex> lock { rhs.rw_mtx_ };
           Base::operator=( std::move( rhs ) );
           using std::swap;
           swap( visual_masks_, rhs.visual_masks_ );
@@ -181,9 +181,9 @@ namespace pgbar {
           std::is_nothrow_copy_assignable<Base>::value )
         {
           PGBAR__TRUST( this != &other );
-          concurrent::SharedLock<concurrent::SharedMutex> lock1 { other.rw_mtx_, std::defer_lock };
+          concurrent::SharedLock<concurrent::RevisedMutex> lock1 { other.rw_mtx_, std::defer_lock };
           std::lock( this->rw_mtx_, lock1 );
-          std::lock_guard<concurrent::SharedMutex> lock2 { this->rw_mtx_, std::adopt_lock };
+          std::lock_guard<concurrent::RevisedMutex> lock2 { this->rw_mtx_, std::adopt_lock };
 
           visual_masks_ = other.visual_masks_;
           Base::operator=( other );
@@ -193,8 +193,8 @@ namespace pgbar {
         {
           PGBAR__TRUST( this != &rhs );
           std::lock( this->rw_mtx_, rhs.rw_mtx_ );
-          std::lock_guard<concurrent::SharedMutex> lock1 { this->rw_mtx_, std::adopt_lock };
-          std::lock_guard<concurrent::SharedMutex> lock2 { rhs.rw_mtx_, std::adopt_lock };
+          std::lock_guard<concurrent::RevisedMutex> lock1 { this->rw_mtx_, std::adopt_lock };
+          std::lock_guard<concurrent::RevisedMutex> lock2 { rhs.rw_mtx_, std::adopt_lock };
 
           using std::swap;
           swap( visual_masks_, rhs.visual_masks_ );
@@ -208,9 +208,9 @@ namespace pgbar {
          */
         ~BasicConfig() = default;
 
-#define PGBAR__METHOD( ReturnType )                                \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ }; \
-  unpack( *this, option::Style( val ) );                           \
+#define PGBAR__METHOD( ReturnType )                                 \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ }; \
+  unpack( *this, option::Style( val ) );                            \
   return static_cast<ReturnType>( *this )
 
         Derived& style( types::Bit8 val ) & noexcept { PGBAR__METHOD( Derived& ); }
@@ -218,7 +218,7 @@ namespace pgbar {
 
 #undef PGBAR__METHOD
 #define PGBAR__METHOD( ReturnType )                                                       \
-  std::lock_guard<concurrent::SharedMutex> lock { this->rw_mtx_ };                        \
+  std::lock_guard<concurrent::RevisedMutex> lock { this->rw_mtx_ };                       \
   unpack( *this, std::move( arg ) );                                                      \
   (void)std::initializer_list<bool> { ( unpack( *this, std::move( args ) ), false )... }; \
   return static_cast<ReturnType>( *this )
@@ -260,7 +260,7 @@ namespace pgbar {
 
         PGBAR__NODISCARD std::uint64_t fixed_width() const noexcept
         {
-          concurrent::SharedLock<concurrent::SharedMutex> lock { this->rw_mtx_ };
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
           return static_cast<const Derived*>( this )->fixed_render_size();
         }
 
@@ -270,8 +270,8 @@ namespace pgbar {
         PGBAR__CXX23_CNSTXPR void swap( BasicConfig& other ) noexcept
         {
           std::lock( this->rw_mtx_, other.rw_mtx_ );
-          std::lock_guard<concurrent::SharedMutex> lock1 { this->rw_mtx_, std::adopt_lock };
-          std::lock_guard<concurrent::SharedMutex> lock2 { other.rw_mtx_, std::adopt_lock };
+          std::lock_guard<concurrent::RevisedMutex> lock1 { this->rw_mtx_, std::adopt_lock };
+          std::lock_guard<concurrent::RevisedMutex> lock2 { other.rw_mtx_, std::adopt_lock };
           using std::swap;
           swap( visual_masks_, other.visual_masks_ );
           Base::swap( other );
@@ -79,6 +79,39 @@ namespace pgbar {
           return do_render<Pos + 1>( istty, hide_done ); // tail recursive
         }
 
+        // Return false if none of the bars would look different in the next frame.
+        PGBAR__NODISCARD bool renew_all() & noexcept
+        {
+          bool renewed = false;
+          (void)std::initializer_list<bool> {
+            ( renewed |= ( at<Tags>().active() && renew( at<Tags>() ) ) )...
+          };
+          return renewed;
+        }
+        // The room needed by a frame holding all the bars.
+        PGBAR__NODISCARD types::Size frame_capacity_all() const noexcept
+        {
+          types::Size capacity = 0;
+          (void)std::initializer_list<bool> { ( capacity += frame_capacity( at<Tags>() ), false )... };
+          return capacity;
+        }
+        // A number that moves whenever a bar is refreshed for a new revision of its configuration.
+        PGBAR__NODISCARD std::uint64_t revision_all() const noexcept
+        {
+          std::uint64_t revision = 0;
+          (void)std::initializer_list<bool> { ( revision += frame_revision( at<Tags>() ), false )... };
+          return revision;
+        }
+        // Return true if none of the active bars would change with the time alone.
+        PGBAR__NODISCARD bool still_all() const noexcept
+        {
+          bool settled = true;
+          (void)std::initializer_list<bool> {
+            ( settled &= ( !at<Tags>().active() || still( at<Tags>() ) ) )...
+          };
+          return settled;
+        }
+
         void do_halt( bool forced ) noexcept final
         { // This virtual function is invoked only via the vtable,
           // hence the default arguments from the base class declaration are always used.
@@ -91,7 +124,7 @@ namespace pgbar {
               executor.template trigger<Mode>();
             if ( alive_cnt_.fetch_sub( 1, std::memory_order_acq_rel ) == 1 ) {
               state_.store( State::Stop, std::memory_order_release );
-              executor.dismiss_then( []() noexcept { io::OStream<Outlet>::itself().release(); } );
+              executor.dismiss_then( []() noexcept { io::OStream<Outlet>::itself().reset(); } );
             }
           }
         }
@@ -120,8 +153,21 @@ namespace pgbar {
                      state_.compare_exchange_strong( expected, State::Refresh, std::memory_order_release );
                    } break;
                    case State::Refresh: {
+                     // The bars don't share a common progress, so only the time matters here.
+                     if ( !istty && !render::Renderer<Outlet>::itself().admit( -1 ) )
+                       break;
                      {
                        std::lock_guard<concurrent::SharedMutex> lock { res_mtx_ };
+                       // Neither the build nor the write is needed if the frame would look the same.
+                       const auto revision = revision_all();
+                       if ( !renew_all() ) {
+                         if ( still_all() )
+                           render::Renderer<Outlet>::itself().still();
+                         break;
+                       }
+                       // A reconfigured bar may need more room than what was made for it at boot.
+                       if ( revision != revision_all() )
+                         PGBAR__UNLIKELY ostream.reserve( frame_capacity_all() );
                        if ( istty ) {
                          if PGBAR__CXX17_CNSTXPR ( Area == Region::Fixed )
                            ostream << console::escodes::resetcursor;
@@ -140,7 +186,10 @@ namespace pgbar {
               PGBAR__UNLIKELY throw exception::InvalidState(
                 charcodes::make_literal( "pgbar: another progress bar instance is already running" ) );
 
-            io::OStream<Outlet>::itself() << io::release;
+            io::OStream<Outlet>::itself() << io::reset;
+            io::OStream<Outlet>::itself().template engage<Mode>();
+            // Make room for the frames up front, so no allocation is left for the rendering.
+            io::OStream<Outlet>::itself().reserve( frame_capacity_all() );
             state_.store( State::Awake, std::memory_order_release );
 
             auto guard = utils::make_scope_fail( [&]() noexcept {
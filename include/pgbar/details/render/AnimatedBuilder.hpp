@@ -4,6 +4,7 @@
 #include "../io/CharPipeline.hpp"
 #include "../utils/Backport.hpp"
 #include "CommonBuilder.hpp"
+#include <algorithm>
 // #include "../prefabs/BasicConfig.hpp"
 
 namespace pgbar {
@@ -14,54 +15,108 @@ namespace pgbar {
       private:
         using Base = CommonBuilder<Config>;
 
-      protected:
-        template<typename... Args>
-        io::CharPipeline& indirect_build( io::CharPipeline& buffer,
-                                          std::uint64_t num_task_done,
-                                          std::uint64_t num_all_tasks,
-                                          types::Float num_percent,
-                                          const std::chrono::steady_clock::time_point& zero_point,
-                                          Args&&... args ) const
+        /**
+         * Lay out the frame into `frame_`.
+         *
+         * If the line is wider than a terminal of `num_columns` columns, the bar indicator is shrunk
+         * down to a few columns first, then the postfix is cut, and then the bar goes on shrinking.
+         */
+        void compile( std::uint16_t num_columns ) const
         {
+          auto& frame = this->frame_;
+          frame.reset( this->revision(), num_columns );
+
+          const bool animated = this->visual_masks_[utils::to_underlying( Config::Mask::Ani )];
+          auto bar_width      = this->bar_width_;
+          auto num_cut        = this->overflow( num_columns, [this, animated]() noexcept {
+            return this->fixed_render_size() + ( animated ? this->bar_width_ : 0 );
+          } );
+          if ( animated && num_cut != 0 ) {
+            // Keep a few columns of the bar until the postfix is gone.
+            constexpr types::Size min_bar_width = 10;
+            const auto num_spare  = bar_width > min_bar_width ? bar_width - min_bar_width : 0;
+            const auto num_shrunk = ( std::min )( num_cut, num_spare );
+            const auto num_rest   = num_cut - num_shrunk;
+            if ( this->postfix_.empty() || num_rest >= this->postfix_.width() + 1 ) {
+              // The postfix can't save the rest, so drop it and shrink the bar even further.
+              const auto num_dropped = this->postfix_.empty() ? 0 : this->postfix_.width() + 1;
+              bar_width = static_cast<std::uint16_t>(
+                bar_width - num_shrunk - ( std::min )( num_rest - num_dropped, bar_width - num_shrunk ) );
+              num_cut = num_dropped;
+            } else {
+              bar_width = static_cast<std::uint16_t>( bar_width - num_shrunk );
+              num_cut   = num_rest;
+            }
+          }
+          frame.bar_width( bar_width );
+
           if ( !this->prefix_.empty() || !this->postfix_.empty() || this->visual_masks_.any() ) {
-            this->try_style( buffer, this->info_col_ );
-            buffer << this->l_border_;
+            this->try_style( frame, this->info_col_ );
+            frame << this->l_border_;
           }
 
-          this->build_prefix( buffer );
-          this->try_reset( buffer );
+          this->build_prefix( frame );
+          this->try_reset( frame );
           if ( this->visual_masks_.any() )
-            this->try_style( buffer, this->info_col_ );
+            this->try_style( frame, this->info_col_ );
           if ( this->visual_masks_[utils::to_underlying( Config::Mask::Per )] ) {
-            this->build_percent( buffer, num_percent );
+            frame.slot( Slot::Percent );
             auto masks = this->visual_masks_;
             if ( masks.reset( utils::to_underlying( Config::Mask::Per ) ).any() )
-              buffer << this->divider_;
+              frame << this->divider_;
           }
-          if ( this->visual_masks_[utils::to_underlying( Config::Mask::Ani )] ) {
-            static_cast<const Impl*>( this )->build_animation( buffer, std::forward<Args>( args )... );
-            this->try_reset( buffer );
+          if ( animated ) {
+            frame.slot( Slot::Animation );
+            this->try_reset( frame );
             auto masks = this->visual_masks_;
             if ( masks.reset( utils::to_underlying( Config::Mask::Ani ) )
                    .reset( utils::to_underlying( Config::Mask::Per ) )
                    .any() ) {
-              this->try_style( buffer, this->info_col_ );
-              buffer << this->divider_;
+              this->try_style( frame, this->info_col_ );
+              frame << this->divider_;
             }
           }
-          this->common_build( buffer, num_task_done, num_all_tasks, zero_point );
+          this->compile_common();
 
-          this->build_postfix( buffer );
-          this->try_reset( buffer );
+          this->build_postfix( frame, num_cut );
+          this->try_reset( frame );
           if ( !this->prefix_.empty() || !this->postfix_.empty() || this->visual_masks_.any() ) {
-            this->try_style( buffer, this->info_col_ );
-            buffer << this->r_border_;
+            this->try_style( frame, this->info_col_ );
+            frame << this->r_border_;
           }
-          return this->try_reset( buffer );
+          this->try_reset( frame );
+          frame.seal();
+        }
+
+      protected:
+        // Only the slots are formatted on every frame, the rest is copied from the compiled frame.
+        template<typename... Args>
+        io::CharPipeline& indirect_build( io::CharPipeline& buffer,
+                                          std::uint16_t num_columns,
+                                          std::uint64_t num_task_done,
+                                          std::uint64_t num_all_tasks,
+                                          types::Float num_percent,
+                                          const std::chrono::steady_clock::time_point& zero_point,
+                                          Args&&... args ) const
+        {
+          if ( !this->frame_.compiled( this->revision(), num_columns ) )
+            PGBAR__UNLIKELY compile( num_columns );
+          return this->replay( buffer, num_task_done, num_all_tasks, zero_point, [&]( Slot slot ) {
+            if ( slot == Slot::Percent )
+              this->build_percent( buffer, num_percent );
+            else
+              static_cast<const Impl*>( this )->build_animation( buffer, this->frame_.bar_width(), args... );
+          } );
         }
 
       public:
         using Base::Base;
+
+        PGBAR__NODISCARD types::Size frame_capacity() const noexcept
+        {
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          return ( this->fixed_render_size() + this->bar_width_ ) * 4 + 256;
+        }
       };
     } // namespace render
   } // namespace _details
@@ -1,8 +1,13 @@
 #ifndef PGBAR__COMMONBUILDER
 #define PGBAR__COMMONBUILDER
 
+#include "../concurrent/SharedLock.hpp"
+#include "../concurrent/SharedMutex.hpp"
 #include "../io/CharPipeline.hpp"
 #include "../utils/Backport.hpp"
+#include "FrameTemplate.hpp"
+#include <chrono>
+#include <limits>
 // #include "../prefabs/BasicConfig.hpp"
 
 namespace pgbar {
@@ -10,6 +15,8 @@ namespace pgbar {
     namespace render {
       template<typename Config>
       struct CommonBuilder : public Config {
+        static constexpr std::uint64_t _volatile_stamp = ( std::numeric_limits<std::uint64_t>::max )();
+
         using Config::Config;
         PGBAR__CXX23_CNSTXPR CommonBuilder( const CommonBuilder& )              = default;
         PGBAR__CXX23_CNSTXPR CommonBuilder( CommonBuilder&& )                   = default;
@@ -32,44 +39,164 @@ namespace pgbar {
         PGBAR__METHOD( Config&&, std::move, noexcept )
 #undef PGBAR__METHOD
 
+        /**
+         * Return the number of tasks that can be finished without changing the visible output,
+         * counting only the components driven by the progress (the time-driven ones are ignored).
+
+         * It's 1 if every single task matters, e.g. when the counter is visible.
+         */
+        PGBAR__NODISCARD std::uint64_t visible_stride( std::uint64_t num_all_tasks ) const noexcept
+        {
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          if ( this->visual_masks_[utils::to_underlying( Config::Mask::Cnt )] )
+            return 1;
+
+          std::uint64_t num_states = 1;
+          if ( this->visual_masks_[utils::to_underlying( Config::Mask::Per )] )
+            num_states = 10000; // the percent meter has two decimal places
+          if ( this->visual_masks_[utils::to_underlying( Config::Mask::Ani )] ) {
+            const auto resolution = this->animation_resolution();
+            if ( resolution == 0 )
+              return 1;
+            num_states = resolution > num_states ? resolution : num_states;
+          }
+          return num_all_tasks / num_states > 1 ? num_all_tasks / num_states : 1;
+        }
+
+        /**
+         * Return a stamp of what the time-driven components show after `zero_point`,
+         * which stays the same as long as they look the same;
+         * or `_volatile_stamp` if they may change at any moment.
+         * If `animated` is true, the animation is considered to move on every frame by itself.
+         */
+        PGBAR__NODISCARD std::uint64_t time_stamp( std::uint64_t num_task_done,
+                                                   std::uint64_t num_all_tasks,
+                                                   const std::chrono::steady_clock::time_point& zero_point,
+                                                   bool animated ) const noexcept
+        {
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          const bool rated = this->visual_masks_[utils::to_underlying( Config::Mask::Sped )]
+                          || this->visual_masks_[utils::to_underlying( Config::Mask::Cntdwn )];
+          if ( animated && this->visual_masks_[utils::to_underlying( Config::Mask::Ani )] )
+            return _volatile_stamp;
+          // The rate keeps changing with the time, unless there's nothing to measure.
+          if ( rated && num_task_done != 0 && num_all_tasks != 0 )
+            return _volatile_stamp;
+          if ( rated || this->visual_masks_[utils::to_underlying( Config::Mask::Elpsd )] ) {
+            const auto time_passed = std::chrono::steady_clock::now() - zero_point;
+            return static_cast<std::uint64_t>(
+              std::chrono::duration_cast<std::chrono::seconds>( time_passed ).count() );
+          }
+          return 0;
+        }
+        /**
+         * Return true if some component on the frame may change with the time alone,
+         * i.e. a frame that's up to date now may not be so a moment later without any task being done.
+         */
+        PGBAR__NODISCARD bool time_driven( bool animated ) const noexcept
+        {
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          return ( animated && this->visual_masks_[utils::to_underlying( Config::Mask::Ani )] )
+              || this->visual_masks_[utils::to_underlying( Config::Mask::Sped )]
+              || this->visual_masks_[utils::to_underlying( Config::Mask::Elpsd )]
+              || this->visual_masks_[utils::to_underlying( Config::Mask::Cntdwn )];
+        }
+        // Return a number that changes whenever the configuration is modified.
+        PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint64_t revision() const noexcept
+        {
+          return this->rw_mtx_.revision();
+        }
+        /**
+         * Return the number of bytes that a frame is expected to take at most, to make room for it up front.
+         * A column takes up to 4 bytes in UTF-8, and the styles of the components add some escape sequences.
+         *
+         * The bar indicator isn't part of `fixed_render_size()`, so `AnimatedBuilder` adds its columns.
+         */
+        PGBAR__NODISCARD types::Size frame_capacity() const noexcept
+        {
+          concurrent::SharedLock<concurrent::RevisedMutex> lock { this->rw_mtx_ };
+          return this->fixed_render_size() * 4 + 256;
+        }
+
       protected:
         /**
-         * Builds and only builds the components belows:
+         * Return how many columns the line overflows a terminal of `num_columns` columns by,
+         * where `line_width` computes the width of the line only if the terminal width is known.
+         */
+        template<typename F>
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE types::Size overflow( std::uint16_t num_columns,
+                                                                         F&& line_width ) noexcept
+        {
+          if ( num_columns == 0 )
+            return 0;
+          const types::Size width = line_width();
+          return width > num_columns ? width - num_columns : 0;
+        }
+
+        // The static bytes of the frames, compiled from the configuration at `frame_.revision_`.
+        mutable FrameTemplate frame_;
+
+        /**
+         * Lays out and only lays out the components belows:
          * `CounterMeter`, `SpeedMeter`, `ElapsedTimer` and `CountdownTimer`
          */
-        io::CharPipeline& common_build( io::CharPipeline& buffer,
-                                        std::uint64_t num_task_done,
-                                        std::uint64_t num_all_tasks,
-                                        const std::chrono::steady_clock::time_point& zero_point ) const
+        void compile_common() const
         {
-          PGBAR__TRUST( num_task_done <= num_all_tasks );
+          auto& frame = this->frame_;
           if ( this->visual_masks_[utils::to_underlying( Config::Mask::Cnt )]
                || this->visual_masks_[utils::to_underlying( Config::Mask::Sped )]
                || this->visual_masks_[utils::to_underlying( Config::Mask::Elpsd )]
                || this->visual_masks_[utils::to_underlying( Config::Mask::Cntdwn )] ) {
             if ( this->visual_masks_[utils::to_underlying( Config::Mask::Cnt )] ) {
-              this->build_counter( buffer, num_task_done, num_all_tasks );
+              frame.slot( Slot::Counter );
               if ( this->visual_masks_[utils::to_underlying( Config::Mask::Sped )]
                    || this->visual_masks_[utils::to_underlying( Config::Mask::Elpsd )]
                    || this->visual_masks_[utils::to_underlying( Config::Mask::Cntdwn )] )
-                buffer << this->divider_;
+                frame << this->divider_;
             }
-            const auto time_passed = std::chrono::steady_clock::now() - zero_point;
             if ( this->visual_masks_[utils::to_underlying( Config::Mask::Sped )] ) {
-              this->build_speed( buffer, time_passed, num_task_done, num_all_tasks );
+              frame.slot( Slot::Speed );
               if ( this->visual_masks_[utils::to_underlying( Config::Mask::Elpsd )]
                    || this->visual_masks_[utils::to_underlying( Config::Mask::Cntdwn )] )
-                buffer << this->divider_;
+                frame << this->divider_;
             }
             if ( this->visual_masks_[utils::to_underlying( Config::Mask::Elpsd )] ) {
-              this->build_elapsed( buffer, time_passed );
+              frame.slot( Slot::Elapsed );
               if ( this->visual_masks_[utils::to_underlying( Config::Mask::Cntdwn )] )
-                buffer << this->divider_;
+                frame << this->divider_;
             }
             if ( this->visual_masks_[utils::to_underlying( Config::Mask::Cntdwn )] )
-              this->build_countdown( buffer, time_passed, num_task_done, num_all_tasks );
+              frame.slot( Slot::Countdown );
           }
-          return buffer;
+        }
+
+        /**
+         * Copy the compiled frame into `buffer`, filling in the slots of the components laid out by
+         * `compile_common` here, and passing the other slots to `fill`.
+         */
+        template<typename F>
+        io::CharPipeline& replay( io::CharPipeline& buffer,
+                                  std::uint64_t num_task_done,
+                                  std::uint64_t num_all_tasks,
+                                  const std::chrono::steady_clock::time_point& zero_point,
+                                  F&& fill ) const
+        {
+          PGBAR__TRUST( num_task_done <= num_all_tasks );
+          const auto time_passed = this->frame_.timed() ? std::chrono::steady_clock::now() - zero_point
+                                                        : std::chrono::steady_clock::duration::zero();
+          return this->frame_.replay( buffer, [&]( Slot slot ) {
+            switch ( slot ) {
+            case Slot::Counter: this->build_counter( buffer, num_task_done, num_all_tasks ); break;
+            case Slot::Speed:
+              this->build_speed( buffer, time_passed, num_task_done, num_all_tasks );
+              break;
+            case Slot::Elapsed: this->build_elapsed( buffer, time_passed ); break;
+            case Slot::Countdown:
+              this->build_countdown( buffer, time_passed, num_task_done, num_all_tasks );
+              break;
+            default:            fill( slot ); break;
+            }
+          } );
         }
       };
     } // namespace render
@@ -0,0 +1,191 @@
+#ifndef PGBAR__DISPATCHER
+#define PGBAR__DISPATCHER
+
+#include "../concurrent/Util.hpp"
+#include "../core/Core.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace pgbar {
+  namespace _details {
+    namespace render {
+      // An object that is served by the render thread.
+      class Servant {
+      public:
+        using TimePoint = std::chrono::steady_clock::time_point;
+
+        // Perform whatever is due at `now`, and return the next time point it should be served at.
+        virtual TimePoint serve( TimePoint now ) noexcept = 0;
+        /**
+         * The earliest time point at which there's something to do, which may be `now` or before it;
+         * or `TimePoint::max()` if there's nothing to do until a request arrives.
+         */
+        PGBAR__NODISCARD virtual TimePoint due( TimePoint now ) const noexcept = 0;
+
+      protected:
+        ~Servant() = default;
+      };
+
+      /**
+       * The render thread shared by the renderers of all channels.
+
+       * On every round it serves the enrolled renderers in the order of their channels,
+       * and then sleeps until the earliest time point they ask for, or until it's woken up.
+       */
+      class Dispatcher final {
+        using TimePoint = Servant::TimePoint;
+
+        std::vector<std::pair<int, Servant*>> servants_;
+        std::atomic<bool> parked_;
+        bool woken_, stop_;
+        std::thread runner_;
+
+        mutable std::mutex serve_mtx_;
+        std::mutex sched_mtx_;
+        std::condition_variable cond_var_;
+#ifndef __cpp_lib_atomic_wait
+        std::mutex ack_mtx_;
+        std::condition_variable ack_var_;
+#endif
+
+        void run() noexcept
+        {
+          while ( true ) {
+            auto deadline = ( TimePoint::max )();
+            {
+              std::lock_guard<std::mutex> lock { serve_mtx_ };
+              for ( auto& servant : servants_ )
+                deadline = (std::min)( deadline, servant.second->serve( std::chrono::steady_clock::now() ) );
+            }
+
+            /* Producers only wake up a parked dispatcher, so `parked_` and their requests form a Dekker pair:
+             * either the producer sees the flag, or `due()` sees the request.
+             * A request seen here may not be due yet, then it's served at the time it becomes due. */
+            parked_.store( true, std::memory_order_seq_cst );
+            deadline = (std::min)( deadline, due() );
+            if ( deadline > std::chrono::steady_clock::now() ) {
+              std::unique_lock<std::mutex> lock { sched_mtx_ };
+              auto awake = [this]() noexcept { return woken_ || stop_; };
+              if ( deadline == ( TimePoint::max )() )
+                cond_var_.wait( lock, awake );
+              else
+                cond_var_.wait_until( lock, deadline, awake );
+            }
+            parked_.store( false, std::memory_order_relaxed );
+
+            std::lock_guard<std::mutex> lock { sched_mtx_ };
+            woken_ = false;
+            if ( stop_ )
+              return;
+          }
+        }
+        PGBAR__NODISCARD TimePoint due() const noexcept
+        {
+          std::lock_guard<std::mutex> lock { serve_mtx_ };
+          const auto now = std::chrono::steady_clock::now();
+          auto ret       = ( TimePoint::max )();
+          for ( const auto& servant : servants_ )
+            ret = (std::min)( ret, servant.second->due( now ) );
+          return ret;
+        }
+
+        Dispatcher() noexcept : parked_ { false }, woken_ { false }, stop_ { false } {}
+
+      public:
+        static Dispatcher& itself() noexcept
+        {
+          static Dispatcher instance;
+          return instance;
+        }
+
+        Dispatcher( const Dispatcher& )              = delete;
+        Dispatcher& operator=( const Dispatcher& ) & = delete;
+        ~Dispatcher() noexcept
+        {
+          {
+            std::lock_guard<std::mutex> lock { sched_mtx_ };
+            stop_ = true;
+            cond_var_.notify_one();
+          }
+          if ( runner_.joinable() )
+            runner_.join();
+        }
+
+        // Start the render thread if it isn't running.
+        void launch() & noexcept( false )
+        {
+          std::lock_guard<std::mutex> lock { sched_mtx_ };
+          if ( !runner_.joinable() )
+            runner_ = std::thread( [this]() noexcept { run(); } );
+        }
+
+        // Servants are served in the ascending order of `order`, which keeps the output order stable.
+        void enroll( int order, Servant* servant ) & noexcept( false )
+        {
+          PGBAR__ASSERT( servant != nullptr );
+          std::lock_guard<std::mutex> lock { serve_mtx_ };
+          auto itr = std::find_if( servants_.begin(),
+                                   servants_.end(),
+                                   [order]( const std::pair<int, Servant*>& e ) noexcept {
+                                     return e.first >= order;
+                                   } );
+          if ( itr == servants_.end() || itr->second != servant )
+            servants_.emplace( itr, order, servant );
+        }
+        // After returning, the servant is guaranteed not to be served any more.
+        void withdraw( Servant* servant ) noexcept
+        {
+          std::lock_guard<std::mutex> lock { serve_mtx_ };
+          servants_.erase( std::remove_if( servants_.begin(),
+                                           servants_.end(),
+                                           [servant]( const std::pair<int, Servant*>& e ) noexcept {
+                                             return e.second == servant;
+                                           } ),
+                           servants_.end() );
+        }
+
+        void wake() noexcept
+        {
+          std::lock_guard<std::mutex> lock { sched_mtx_ };
+          woken_ = true;
+          cond_var_.notify_one();
+        }
+        PGBAR__NODISCARD PGBAR__FORCEINLINE bool parked() const noexcept
+        {
+          return parked_.load( std::memory_order_seq_cst );
+        }
+
+        // Called by the render thread after it has handled a request, to release the threads in `await`.
+        PGBAR__FORCEINLINE void settle() noexcept
+        {
+#ifndef __cpp_lib_atomic_wait
+          std::lock_guard<std::mutex> lock { ack_mtx_ };
+          ack_var_.notify_all();
+#endif
+        }
+#ifndef __cpp_lib_atomic_wait
+        // Block until `pred` holds, which is made true by the render thread before it calls `settle`.
+        template<typename F>
+        void await( F&& pred ) noexcept
+        {
+          concurrent::spin_with(
+            pred,
+            [&]() noexcept {
+              std::unique_lock<std::mutex> lock { ack_mtx_ };
+              ack_var_.wait( lock, pred );
+            },
+            128 );
+        }
+#endif
+      };
+    } // namespace render
+  } // namespace _details
+} // namespace pgbar
+
+#endif
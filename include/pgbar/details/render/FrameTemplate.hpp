@@ -0,0 +1,97 @@
+#ifndef PGBAR__FRAMETEMPLATE
+#define PGBAR__FRAMETEMPLATE
+
+#include "../io/CharPipeline.hpp"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace pgbar {
+  namespace _details {
+    namespace render {
+      // The components whose output changes from one frame to another.
+      enum class Slot : std::uint8_t { Percent, Animation, Counter, Speed, Elapsed, Countdown };
+
+      /**
+       * The bytes that stay the same in every frame, and the slots between them that are filled in per frame.
+       *
+       * It's compiled by running the layout of a builder against the template itself,
+       * which appends the static bytes and marks the slots by `slot()`;
+       * so it only has to be compiled again when the configuration or the terminal width changes.
+       * A copy is never compiled, it will be compiled for whatever it's copied into.
+       */
+      class FrameTemplate final : public io::CharPipeline {
+        // Each slot with the end of the static bytes in front of it.
+        std::vector<std::pair<Slot, types::Size>> slots_;
+        std::uint64_t revision_;
+        std::uint16_t num_columns_, bar_width_;
+        bool timed_, compiled_;
+
+      public:
+        FrameTemplate() noexcept
+          : revision_ { 0 }, num_columns_ { 0 }, bar_width_ { 0 }, timed_ { false }, compiled_ { false }
+        {}
+        FrameTemplate( const FrameTemplate& ) noexcept : FrameTemplate() {}
+        FrameTemplate& operator=( const FrameTemplate& ) & noexcept
+        {
+          compiled_ = false;
+          return *this;
+        }
+        ~FrameTemplate() = default;
+
+        PGBAR__NODISCARD PGBAR__FORCEINLINE bool compiled( std::uint64_t revision,
+                                                           std::uint16_t num_columns ) const noexcept
+        {
+          return compiled_ && revision_ == revision && num_columns_ == num_columns;
+        }
+
+        // Drop what was compiled, to compile it again for the configuration at `revision`.
+        void reset( std::uint64_t revision, std::uint16_t num_columns ) & noexcept
+        {
+          clear();
+          slots_.clear();
+          revision_    = revision;
+          num_columns_ = num_columns;
+          bar_width_   = 0;
+          timed_       = false;
+          compiled_    = false;
+        }
+        void seal() & noexcept { compiled_ = true; }
+
+        void slot( Slot kind ) &
+        {
+          slots_.emplace_back( kind, buffer_.size() );
+          timed_ = timed_ || kind == Slot::Speed || kind == Slot::Elapsed || kind == Slot::Countdown;
+        }
+        // Whether any slot depends on the time passed.
+        PGBAR__NODISCARD PGBAR__FORCEINLINE bool timed() const noexcept { return timed_; }
+
+        // The width of the bar indicator after fitting the line to the terminal.
+        PGBAR__FORCEINLINE void bar_width( std::uint16_t width ) & noexcept { bar_width_ = width; }
+        PGBAR__NODISCARD PGBAR__FORCEINLINE std::uint16_t bar_width() const noexcept { return bar_width_; }
+
+        /**
+         * Append the static bytes to `buffer`, and call `fill( slot )` for every slot in between.
+         * The static bytes are only referenced by `buffer` in its scatter mode, so the template mustn't be
+         * compiled again until the output is written.
+         */
+        template<typename F>
+        io::CharPipeline& replay( io::CharPipeline& buffer, F&& fill ) const
+        {
+          types::Size offset = 0;
+          for ( const auto& slot : slots_ ) {
+            if ( slot.second != offset )
+              buffer.refer( buffer_.data() + offset, buffer_.data() + slot.second );
+            fill( slot.first );
+            offset = slot.second;
+          }
+          if ( offset != buffer_.size() )
+            buffer.refer( buffer_.data() + offset, buffer_.data() + buffer_.size() );
+          return buffer;
+        }
+      };
+    } // namespace render
+  } // namespace _details
+} // namespace pgbar
+
+#endif
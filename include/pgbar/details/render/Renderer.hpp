@@ -2,31 +2,53 @@
 #define PGBAR__RENDERER
 
 #include "../concurrent/ExceptionBox.hpp"
+#include "../concurrent/SharedMutex.hpp"
 #include "../concurrent/Util.hpp"
 #include "../console/TermContext.hpp"
+#include "../io/OStream.hpp"
 #include "../utils/ScopeGuard.hpp"
 #include "../wrappers/UniqueFunction.hpp"
+#include "Dispatcher.hpp"
+#include <algorithm>
 #include <atomic>
-#include <thread>
-#ifndef __cpp_lib_atomic_wait
-# include <condition_variable>
-#endif
+#include <mutex>
+#include <utility>
 
 namespace pgbar {
   namespace _details {
     namespace render {
       template<Channel Tag>
-      class Renderer final {
+      class Renderer final : public Servant {
         static std::atomic<TimeGranule> _working_interval;
+        static std::atomic<TimeGranule> _signal_interval;
+        // The bounds of the adaptive interval, which is disabled while the upper bound is zero.
+        static std::atomic<TimeGranule> _min_interval;
+        static std::atomic<TimeGranule> _max_interval;
+        // How often a channel that isn't bound to a terminal receives a routine frame.
+        static std::atomic<TimeGranule> _log_interval;
+        static std::atomic<std::uint8_t> _log_milestone;
+        // Whether the renderer of this channel is registered to be roused by the revisions.
+        static std::atomic<bool> _observing;
 
         std::atomic<std::uint64_t> quota_      = { 0 };
+        // When the caller rendered the last frame, as given by `stamp()`.
+        std::atomic<std::int64_t> last_shot_   = { 0 };
+        // Under `Policy::External` the render thread is never involved, the caller renders by `poll()`.
+        std::atomic<bool> polled_              = { false };
+        // Set while the render thread parks under `Policy::Async`, until a request or a revision arrives.
+        std::atomic<bool> resting_             = { false };
         concurrent::ExceptionBox box_          = {};
         wrappers::UniqueFunction<void()> task_ = {};
-        std::thread runner_                    = {};
+        // Only accessed by the render thread; the cost of writing a frame is measured by the `OStream`.
+        TimePoint last_frame_   = {};
+        TimeGranule frame_cost_ = {};
+        // Only accessed by the thread running the task, under the same serialization as the task itself.
+        bool routine_                 = false;
+        bool still_                   = false;
+        TimePoint last_line_          = {};
+        std::uint64_t last_milestone_ = 0;
+        Dispatcher& dispatcher_;
 
-#ifndef __cpp_lib_atomic_wait
-        mutable std::condition_variable cond_var_ = {};
-#endif
         mutable concurrent::SharedMutex res_mtx_ = {};
         mutable std::mutex sched_mtx_            = {};
 
@@ -39,131 +61,211 @@ namespace pgbar {
                             ├─ activate<Signal>() → Primed → Pulse
                             │                                  └ trigger<Signal>() → Primed
                             │
-                            └─ activate<Sync>() → Idle
-                                                   └ trigger<Sync>() → Shot → Idle
+                            └─ activate<Sync | Throttle>() → Idle
+                                                              └ trigger<Sync | Throttle>() → Shot → Idle
 
           any state
             └─ abort() → Asleep → Dormant
 
           any state
             └─ drop() → Dead
+
+          activate<External>() doesn't touch the state machine, it only enables `poll()`.
         ***********************************************************/
         enum class State : std::uint8_t { Dead, Asleep, Dormant, Warmup, Loop, Primed, Pulse, Shot, Idle };
         std::atomic<State> state_ = { State::Dead };
 
+        // The interval actually used by the render thread, adapted to the measured cost of a frame.
+        PGBAR__NODISCARD TimeGranule pace( TimeGranule base ) const noexcept
+        {
+          const auto upper = _max_interval.load( std::memory_order_acquire );
+          if ( upper == TimeGranule::zero() )
+            return base;
+          // Nobody is watching a pipe or a file, so the frames are only kept for the record.
+          if ( !console::TermContext<Tag>::itself().connected() )
+            return upper;
+          /* Keep the time spent on building frames within 1/20 of the render thread's time,
+           * and leave the sink idle for at least half of the time, so the frames never queue up behind it. */
+          const auto write_cost = io::OStream<Tag>::itself().write_cost();
+          const auto lower      = _min_interval.load( std::memory_order_acquire );
+          return (std::min)(
+            (std::max)( (std::max)( (std::max)( base, frame_cost_ * 20 ), write_cost * 2 ), lower ),
+            upper );
+        }
+        // `routine` tells `admit` whether the frame is a periodic one rather than one required by the caller.
+        void perform( bool routine ) & noexcept( false )
+        {
+          routine_ = routine;
+          task_();
+        }
+        // Render a frame on the render thread, and fold its cost into the moving average.
+        void draw( bool routine ) & noexcept( false )
+        {
+          const auto start = std::chrono::steady_clock::now();
+          perform( routine );
+          last_frame_ = std::chrono::steady_clock::now();
+          frame_cost_ += ( std::chrono::duration_cast<TimeGranule>( last_frame_ - start ) - frame_cost_ ) / 8;
+        }
+
+        /**
+         * Render a routine frame under `Policy::Async`, and return true if the render thread can park,
+         * which is when the task has found nothing to refresh and nothing that changes with the time alone.
+
+         * `resting_` is raised before the task looks at the bar, so a request that comes after that look
+         * either sees the flag and wakes the thread up, or is seen by the task in the first place.
+         */
+        PGBAR__NODISCARD bool doze() & noexcept( false )
+        {
+          still_ = false;
+          resting_.store( true, std::memory_order_seq_cst );
+          std::atomic_thread_fence( std::memory_order_seq_cst );
+          draw( true );
+          if ( still_ )
+            return resting_.load( std::memory_order_seq_cst );
+          resting_.store( false, std::memory_order_relaxed );
+          return false;
+        }
+        static void rouse_all() noexcept;
+
+        // Commit the state handled by the render thread, and release the thread waiting for it.
+        PGBAR__FORCEINLINE bool acknowledge( State expected, State desired ) noexcept
+        {
+          const bool done = concurrent::atomic_commit_all( state_, expected, desired );
+          if ( done )
+            dispatcher_.settle();
+          return done;
+        }
+
+        // Called by the render thread, which is shared with the renderers of the other channels.
+        TimePoint serve( TimePoint now ) noexcept override
+        {
+          const auto state = state_.load( std::memory_order_acquire );
+          try {
+            switch ( state ) {
+            case State::Asleep: {
+              acknowledge( State::Asleep, State::Dormant );
+            } break;
+
+            case State::Warmup: {
+              resting_.store( false, std::memory_order_relaxed );
+              perform( false );
+              if ( acknowledge( State::Warmup, State::Loop ) ) {
+                draw( true );
+                return last_frame_ + pace( working_interval() );
+              }
+            } break;
+
+            case State::Loop: {
+              const auto due = last_frame_ + pace( working_interval() );
+              if ( now < due )
+                return due;
+              if ( doze() )
+                break;
+              return last_frame_ + pace( working_interval() );
+            }
+
+            case State::Primed: {
+              quota_.exchange( 0, std::memory_order_acq_rel );
+              draw( false );
+              acknowledge( State::Primed, State::Pulse );
+            } break;
+
+            case State::Pulse: {
+              if ( quota_.load( std::memory_order_seq_cst ) == 0 )
+                break;
+              // Requests that arrive within the minimum interval are merged into the next frame.
+              const auto due = last_frame_ + pace( signal_interval() );
+              if ( now < due )
+                return due;
+              // All the pending requests are drained by one frame.
+              quota_.exchange( 0, std::memory_order_acq_rel );
+              draw( true );
+              // The requests that arrived during the frame found the thread busy and didn't wake it up.
+              if ( quota_.load( std::memory_order_seq_cst ) > 0 )
+                return last_frame_ + pace( signal_interval() );
+            } break;
+
+            case State::Shot: {
+              {
+                concurrent::SharedLock<concurrent::SharedMutex> lock1 { res_mtx_ };
+                std::lock_guard<std::mutex> lock2 { sched_mtx_ };
+                perform( false );
+              }
+              acknowledge( State::Shot, State::Idle );
+            } break;
+
+            default: break;
+            }
+          } catch ( ... ) {
+            const auto stored = box_.try_store( std::current_exception() );
+            (void)stored; // only the earliest exception is kept
+            acknowledge( state, State::Dormant );
+          }
+          return ( TimePoint::max )();
+        }
+        PGBAR__NODISCARD TimePoint due( TimePoint now ) const noexcept override
+        {
+          switch ( state_.load( std::memory_order_acquire ) ) {
+          case State::Asleep:
+          case State::Warmup:
+          case State::Primed:
+          case State::Shot:   return now;
+          case State::Loop:
+            return resting_.load( std::memory_order_seq_cst ) ? ( TimePoint::max )()
+                                                              : last_frame_ + pace( working_interval() );
+          case State::Pulse:
+            return quota_.load( std::memory_order_seq_cst ) > 0 ? last_frame_ + pace( signal_interval() )
+                                                                : ( TimePoint::max )();
+          default: return ( TimePoint::max )();
+          }
+        }
+
+        // The time since the epoch of the steady clock, counted in `TimeGranule`.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE std::int64_t stamp() noexcept
+        {
+          const auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+          return std::chrono::duration_cast<TimeGranule>( since_epoch ).count();
+        }
+
         void launch() & noexcept( false )
         {
           console::TermContext<Tag>::itself().virtual_term();
-          PGBAR__ASSERT( runner_.get_id() == std::thread::id() );
           auto guard = utils::make_scope_fail(
             [this]() noexcept { state_.store( State::Dead, std::memory_order_release ); } );
 
-          runner_ = std::thread( [this]() {
-            try {
-              for ( auto state = state_.load( std::memory_order_acquire ); state != State::Dead;
-                    state      = state_.load( std::memory_order_acquire ) ) {
-                switch ( state ) {
-                case State::Asleep:
-                  concurrent::atomic_commit_all( state_, State::Asleep, State::Dormant );
-                  PGBAR__FALLTHROUGH;
-                case State::Dormant: {
-#ifdef __cpp_lib_atomic_wait
-                  state_.wait( State::Dormant, std::memory_order_acquire );
-#else
-                  std::unique_lock<std::mutex> lock { sched_mtx_ };
-                  cond_var_.wait( lock, [this]() noexcept {
-                    return state_.load( std::memory_order_acquire ) != State::Dormant;
-                  } );
-#endif
-                } break;
-
-                case State::Warmup: {
-                  task_();
-                  concurrent::atomic_commit_all( state_, State::Warmup, State::Loop );
-                }
-                  PGBAR__FALLTHROUGH;
-                case State::Loop: {
-                  task_();
-                  std::this_thread::sleep_for( working_interval() );
-                } break;
-
-                case State::Primed: {
-                  task_();
-                  quota_.fetch_sub( 1, std::memory_order_release );
-                  concurrent::atomic_commit_all( state_, State::Primed, State::Pulse );
-                }
-                  PGBAR__FALLTHROUGH;
-                case State::Pulse: {
-#ifdef __cpp_lib_atomic_wait
-                  quota_.wait( 0, std::memory_order_acquire );
-#else
-                  concurrent::spin_with(
-                    [this]() noexcept { return quota_.load( std::memory_order_acquire ) > 0; },
-                    [this]() noexcept {
-                      std::unique_lock<std::mutex> lock { sched_mtx_ };
-                      cond_var_.wait( lock, [this]() noexcept {
-                        return quota_.load( std::memory_order_acquire ) > 0
-                            || state_.load( std::memory_order_acquire ) != State::Pulse;
-                      } );
-                    },
-                    1024 );
-#endif
-                  do
-                    task_();
-                  while ( quota_.fetch_sub( 1, std::memory_order_acq_rel ) > 1
-                          && state_.load( std::memory_order_acquire ) == State::Pulse );
-                } break;
-
-                case State::Shot: {
-                  {
-                    concurrent::SharedLock<concurrent::SharedMutex> lock1 { res_mtx_ };
-                    std::lock_guard<std::mutex> lock2 { sched_mtx_ };
-                    task_();
-                  }
-                  concurrent::atomic_commit_all( state_, State::Shot, State::Idle );
-                }
-                  PGBAR__FALLTHROUGH;
-                case State::Idle: {
+          dispatcher_.enroll( static_cast<int>( Tag ), this );
+          state_.store( State::Dormant, std::memory_order_release );
+          dispatcher_.launch();
+          // A parked render thread must redraw the frame once the configuration is modified.
+          if ( !_observing.exchange( true, std::memory_order_acq_rel ) )
+            concurrent::RevisedMutex::observe( &rouse_all );
+        }
+
+        // Hand the new state to the render thread and wait until it has been handled.
+        PGBAR__FORCEINLINE void hand_over( State desired ) noexcept
+        {
+          dispatcher_.wake();
 #ifdef __cpp_lib_atomic_wait
-                  state_.wait( State::Idle, std::memory_order_acquire );
+          state_.wait( desired, std::memory_order_acquire );
 #else
-                  std::unique_lock<std::mutex> lock { sched_mtx_ };
-                  cond_var_.wait( lock, [this]() noexcept {
-                    return state_.load( std::memory_order_acquire ) != State::Idle;
-                  } );
+          dispatcher_.await( [&]() noexcept { return state_.load( std::memory_order_acquire ) != desired; } );
 #endif
-                } break;
-
-                default: return;
-                }
-              }
-            } catch ( ... ) {
-              auto dump = box_.try_store( std::current_exception() );
-              concurrent::atomic_commit_all( state_, dump ? State::Dormant : State::Dead );
-              if ( !dump )
-                throw;
-            }
-          } );
-          auto expected = State::Dead;
-          state_.compare_exchange_strong( expected, State::Dormant, std::memory_order_release );
         }
 
         void shutdown() noexcept
         {
           concurrent::atomic_commit_all( state_, State::Dead );
-#ifndef __cpp_lib_atomic_wait
+          dispatcher_.settle();
+          // Once withdrawn, the render thread never touches this object again.
+          dispatcher_.withdraw( this );
           {
-            std::lock_guard<std::mutex> lock { sched_mtx_ };
-            cond_var_.notify_all();
+            std::lock_guard<concurrent::SharedMutex> lock { res_mtx_ };
+            task_ = nullptr;
           }
-#endif
-          if ( runner_.joinable() )
-            runner_.join();
-          runner_ = std::thread();
-          task_   = nullptr;
+          polled_.store( false, std::memory_order_release );
         }
 
-        Renderer() = default;
+        Renderer() noexcept : dispatcher_ { Dispatcher::itself() } {}
 
       public:
         // Get the current working interval for all threads.
@@ -176,6 +278,45 @@ namespace pgbar {
         {
           _working_interval.store( new_rate, std::memory_order_release );
         }
+        // Get the minimum interval between two frames rendered by `Policy::Signal`.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE TimeGranule signal_interval() noexcept
+        {
+          return _signal_interval.load( std::memory_order_acquire );
+        }
+        static PGBAR__FORCEINLINE void signal_interval( TimeGranule new_rate ) noexcept
+        {
+          _signal_interval.store( new_rate, std::memory_order_release );
+        }
+        // Get the bounds within which the render thread adapts its interval.
+        PGBAR__NODISCARD static std::pair<TimeGranule, TimeGranule> interval_bounds() noexcept
+        {
+          return std::make_pair( _min_interval.load( std::memory_order_acquire ),
+                                 _max_interval.load( std::memory_order_acquire ) );
+        }
+        static void interval_bounds( TimeGranule lower, TimeGranule upper ) noexcept
+        {
+          PGBAR__ASSERT( lower <= upper );
+          _min_interval.store( lower, std::memory_order_release );
+          _max_interval.store( upper, std::memory_order_release );
+        }
+        // Get the interval between two routine lines written to a channel that isn't bound to a terminal.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE TimeGranule log_interval() noexcept
+        {
+          return _log_interval.load( std::memory_order_acquire );
+        }
+        static PGBAR__FORCEINLINE void log_interval( TimeGranule new_rate ) noexcept
+        {
+          _log_interval.store( new_rate, std::memory_order_release );
+        }
+        // Get the percentage between two routine lines written to a channel that isn't bound to a terminal.
+        PGBAR__NODISCARD static PGBAR__FORCEINLINE std::uint8_t log_milestone() noexcept
+        {
+          return _log_milestone.load( std::memory_order_acquire );
+        }
+        static PGBAR__FORCEINLINE void log_milestone( std::uint8_t percentage ) noexcept
+        {
+          _log_milestone.store( percentage, std::memory_order_release );
+        }
 
         static Renderer& itself() noexcept
         {
@@ -185,20 +326,37 @@ namespace pgbar {
 
         Renderer( const Renderer& )              = delete;
         Renderer& operator=( const Renderer& ) & = delete;
-        ~Renderer() noexcept { shutdown(); }
+        ~Renderer() noexcept
+        {
+          // The other channel may still be observing, so only this registration is withdrawn.
+          if ( _observing.exchange( false, std::memory_order_acq_rel ) )
+            concurrent::RevisedMutex::unobserve();
+          shutdown();
+        }
 
         // `activate` guarantees to perform the render task at least once.
         template<Policy Mode>
         void activate() & noexcept( false )
         {
+          if PGBAR__CXX17_CNSTXPR ( Mode == Policy::External ) {
+            PGBAR__ASSERT( task_ != nullptr );
+            box_.rethrow();
+            if ( !polled_.load( std::memory_order_acquire ) ) {
+              // No render thread is launched, so the terminal is set up here before the first frame.
+              console::TermContext<Tag>::itself().virtual_term();
+              std::lock_guard<concurrent::SharedMutex> lock1 { res_mtx_ };
+              std::lock_guard<std::mutex> lock2 { sched_mtx_ };
+              perform( false );
+              last_shot_.store( stamp(), std::memory_order_relaxed );
+              polled_.store( true, std::memory_order_release );
+            }
+            return;
+          }
+
           if ( state_.load( std::memory_order_acquire ) == State::Dead ) {
             std::lock_guard<concurrent::SharedMutex> lock { res_mtx_ };
-            if ( runner_.get_id() == std::thread::id() )
+            if ( state_.load( std::memory_order_acquire ) == State::Dead )
               launch();
-            else {
-              shutdown();
-              launch();
-            }
           }
 
           PGBAR__ASSERT( state_ != State::Dead );
@@ -210,33 +368,19 @@ namespace pgbar {
               return State::Warmup;
             else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Signal )
               return State::Primed;
-            else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Sync )
+            else
               return State::Idle;
           };
           auto expected = State::Dormant;
           if ( state_.compare_exchange_strong( expected, desired(), std::memory_order_release ) ) {
             quota_.store( 0, std::memory_order_release );
-#ifdef __cpp_lib_atomic_wait
-            state_.notify_one();
-#endif
-            if PGBAR__CXX17_CNSTXPR ( Mode != Policy::Sync ) {
-#ifdef __cpp_lib_atomic_wait
-              state_.wait( desired(), std::memory_order_acquire );
-#else
-              {
-                std::lock_guard<std::mutex> lock { sched_mtx_ };
-                cond_var_.notify_one();
-              }
-              concurrent::spin_wait(
-                [&]() noexcept { return state_.load( std::memory_order_acquire ) != desired(); } );
-#endif
-            } else {
+            if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Async || Mode == Policy::Signal )
+              hand_over( desired() );
+            else {
               std::lock_guard<concurrent::SharedMutex> lock1 { res_mtx_ };
               std::lock_guard<std::mutex> lock2 { sched_mtx_ };
-#ifndef __cpp_lib_atomic_wait
-              cond_var_.notify_one();
-#endif
-              task_();
+              perform( false );
+              last_shot_.store( stamp(), std::memory_order_relaxed );
             }
           }
         }
@@ -247,84 +391,122 @@ namespace pgbar {
         {
           if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Signal ) {
             if ( state_.load( std::memory_order_acquire ) != State::Dormant ) {
-              quota_.fetch_add( 1, std::memory_order_release );
-#ifdef __cpp_lib_atomic_wait
-              quota_.notify_one();
-#else
-              std::lock_guard<std::mutex> lock { sched_mtx_ };
-              cond_var_.notify_one();
-#endif
+              // Only the first request since the last frame needs to be published,
+              // and only a parked render thread needs to be woken up.
+              if ( quota_.fetch_add( 1, std::memory_order_seq_cst ) == 0 && dispatcher_.parked() )
+                dispatcher_.wake();
             }
-          } else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Sync ) {
-            PGBAR__ASSERT( state_ == State::Idle );
+          } else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Async )
+            rouse();
+          else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Sync ) {
             std::lock_guard<concurrent::SharedMutex> lock1 { res_mtx_ };
             // To ensure that only one thread is rendering the bar to the OStream.
             std::lock_guard<std::mutex> lock2 { sched_mtx_ };
-            task_();
+            // Another thread may have finished the bar since this request was made.
+            if ( task_ != nullptr )
+              perform( true );
+          } else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Throttle ) {
+            const auto now = stamp();
+            if ( TimeGranule( now - last_shot_.load( std::memory_order_relaxed ) ) < working_interval() )
+              return;
+            // Whoever loses the race just leaves, the winner's frame is recent enough.
+            std::unique_lock<concurrent::SharedMutex> lock1 { res_mtx_, std::try_to_lock };
+            if ( !lock1.owns_lock() )
+              return;
+            std::unique_lock<std::mutex> lock2 { sched_mtx_, std::try_to_lock };
+            if ( !lock2.owns_lock() )
+              return;
+            // The frame of a thread that has just released the locks is recent enough, too.
+            if ( task_ == nullptr
+                 || TimeGranule( now - last_shot_.load( std::memory_order_relaxed ) ) < working_interval() )
+              return;
+            last_shot_.store( now, std::memory_order_relaxed );
+            perform( true );
           }
         }
 
+        // Same as `commit`, but the exception thrown by the render task is stored
+        // and will be rethrown by the next `activate`.
+        template<Policy Mode>
+        PGBAR__FORCEINLINE void commit_nothrow() & noexcept
+        {
+          if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Sync || Mode == Policy::Throttle ) {
+            try {
+              commit<Mode>();
+            } catch ( ... ) {
+              const auto stored = box_.try_store( std::current_exception() );
+              (void)stored; // only the earliest exception is kept
+            }
+          } else
+            commit<Mode>();
+        }
+
+        /**
+         * Called by the render task when it skips a frame since nothing on it has changed
+         * and nothing on it changes with the time alone,
+         * so the render thread can park until the next request or configuration revision.
+         */
+        PGBAR__FORCEINLINE void still() & noexcept { still_ = true; }
+        // Same as `rouse`, but does nothing if the renderer is no longer observing, e.g. it's destroyed.
+        static void rouse_observer() noexcept
+        {
+          if ( _observing.load( std::memory_order_acquire ) )
+            itself().rouse();
+        }
+        // Wake up the render thread if it's parked on a frame that can't change by itself.
+        PGBAR__FORCEINLINE void rouse() noexcept
+        {
+          if ( resting_.load( std::memory_order_seq_cst )
+               && resting_.exchange( false, std::memory_order_seq_cst ) )
+            PGBAR__UNLIKELY dispatcher_.wake();
+        }
+
+        // Keep an exception raised on behalf of the task, so that it's rethrown by the next `activate`.
+        void stash( std::exception_ptr e ) noexcept
+        {
+          const auto stored = box_.try_store( std::move( e ) );
+          (void)stored; // only the earliest exception is kept
+        }
+
         template<Policy Mode>
         void trigger() & noexcept
         {
-#ifdef __cpp_lib_atomic_wait
+          if PGBAR__CXX17_CNSTXPR ( Mode == Policy::External ) {
+            // There's no thread to hand the final frame to, so render it right here.
+            if ( polled_.load( std::memory_order_acquire ) ) {
+              std::lock_guard<concurrent::SharedMutex> lock1 { res_mtx_ };
+              std::lock_guard<std::mutex> lock2 { sched_mtx_ };
+              try {
+                perform( false );
+              } catch ( ... ) {
+                const auto stored = box_.try_store( std::current_exception() );
+                (void)stored;
+              }
+            }
+            return;
+          }
           auto state_transfer = [this]( State expected, State desired ) noexcept {
-            if ( concurrent::atomic_commit_one( state_, expected, desired ) )
-              state_.wait( desired, std::memory_order_acquire );
+            if ( state_.compare_exchange_strong( expected, desired, std::memory_order_release ) )
+              hand_over( desired );
           };
           if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Async )
             state_transfer( State::Loop, State::Warmup );
           else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Signal ) {
-            quota_.fetch_add( 1, std::memory_order_release );
-            auto expected = State::Pulse;
-            if ( state_.compare_exchange_strong( expected, State::Primed, std::memory_order_release ) ) {
-              quota_.notify_one();
-              state_.wait( State::Primed, std::memory_order_acquire );
-            }
-          } else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Sync )
-            state_transfer( State::Idle, State::Shot );
-#else
-          auto state_transfer = [this]( State expected, State desired ) noexcept {
-            if ( state_.compare_exchange_strong( expected, desired, std::memory_order_release ) ) {
-              {
-                std::lock_guard<std::mutex> lock { sched_mtx_ };
-                cond_var_.notify_one();
-              }
-              concurrent::spin_wait(
-                [&]() noexcept { return state_.load( std::memory_order_acquire ) != desired; } );
-            }
-          };
-          if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Async ) {
-            auto expected = State::Loop;
-            if ( state_.compare_exchange_strong( expected, State::Warmup, std::memory_order_release ) )
-              concurrent::spin_wait(
-                [this]() noexcept { return state_.load( std::memory_order_acquire ) != State::Warmup; } );
-          } else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Signal ) {
             quota_.fetch_add( 1, std::memory_order_release );
             state_transfer( State::Pulse, State::Primed );
-          } else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Sync )
+          } else if PGBAR__CXX17_CNSTXPR ( Mode == Policy::Sync || Mode == Policy::Throttle )
             state_transfer( State::Idle, State::Shot );
-#endif
         }
 
         void abort() noexcept
         {
+          polled_.store( false, std::memory_order_release );
           auto try_update = [this]( State expected ) noexcept {
             return concurrent::atomic_commit_one( state_, expected, State::Asleep );
           };
           if ( try_update( State::Warmup ) || try_update( State::Loop ) || try_update( State::Primed )
-               || try_update( State::Pulse ) || try_update( State::Shot ) || try_update( State::Idle ) ) {
-#ifdef __cpp_lib_atomic_wait
-            state_.wait( State::Asleep, std::memory_order_acquire );
-#else
-            {
-              std::lock_guard<std::mutex> lock { sched_mtx_ };
-              cond_var_.notify_all();
-            }
-            concurrent::spin_wait(
-              [this]() noexcept { return state_.load( std::memory_order_acquire ) != State::Asleep; } );
-#endif
-          }
+               || try_update( State::Pulse ) || try_update( State::Shot ) || try_update( State::Idle ) )
+            hand_over( State::Asleep );
         }
 
         template<typename F>
@@ -344,18 +526,75 @@ namespace pgbar {
           dismiss_then( []() noexcept {} );
         }
 
-        void drop() noexcept
-        {
-          std::lock_guard<concurrent::SharedMutex> lock { res_mtx_ };
-          shutdown();
-        }
+        void drop() noexcept { shutdown(); }
 
         PGBAR__NODISCARD bool try_appoint( wrappers::UniqueFunction<void()>&& task ) & noexcept( false )
         {
           std::lock_guard<concurrent::SharedMutex> lock { res_mtx_ };
           if ( task_ != nullptr )
             return false;
-          task_ = std::move( task );
+          task_           = std::move( task );
+          last_line_      = std::chrono::steady_clock::now();
+          last_milestone_ = 0;
+          return true;
+        }
+
+        /**
+         * Render a frame on the calling thread if the task is running under `Policy::External`
+         * and the working interval has elapsed since the last frame.
+
+         * Return the time left until the next frame is due, or `TimeGranule::max()` if there's no such task.
+         */
+        PGBAR__NODISCARD TimeGranule poll() & noexcept( false )
+        {
+          if ( !polled_.load( std::memory_order_acquire ) )
+            return (TimeGranule::max)();
+          const auto interval = working_interval();
+          const auto now      = stamp();
+          const auto elapsed  = TimeGranule( now - last_shot_.load( std::memory_order_relaxed ) );
+          if ( elapsed < interval )
+            return interval - elapsed;
+
+          // Another thread is polling or the task is being dismissed, either way there's nothing to do now.
+          std::unique_lock<concurrent::SharedMutex> lock1 { res_mtx_, std::try_to_lock };
+          if ( !lock1.owns_lock() )
+            return interval;
+          if ( !polled_.load( std::memory_order_acquire ) )
+            return (TimeGranule::max)();
+          std::lock_guard<std::mutex> lock2 { sched_mtx_ };
+          // Another thread may have polled in between, and its frame is recent enough.
+          const auto since = TimeGranule( now - last_shot_.load( std::memory_order_relaxed ) );
+          if ( since < interval )
+            return since > TimeGranule::zero() ? interval - since : interval;
+          last_shot_.store( now, std::memory_order_relaxed );
+          perform( true );
+          return interval;
+        }
+
+        /**
+         * Called by the render task before it writes a refresh frame to a channel that isn't a terminal;
+         * `ratio` is the fraction of the finished tasks, or negative if there's no such thing.
+
+         * Return false if the frame should be dropped, so that the log receives a line per milestone
+         * or per interval rather than one per frame; the frames requested by `activate` and `trigger`,
+         * which carry the start and the end of a task, are never dropped.
+         */
+        PGBAR__NODISCARD bool admit( types::Float ratio ) & noexcept
+        {
+          const auto interval = log_interval();
+          const auto step     = log_milestone();
+          if ( !routine_ || ( interval == TimeGranule::zero() && step == 0 ) )
+            return true;
+
+          const auto now       = std::chrono::steady_clock::now();
+          const auto milestone = ratio < 0 || step == 0
+                                 ? last_milestone_
+                                 : static_cast<std::uint64_t>( ratio * 100 ) / step;
+          if ( milestone == last_milestone_
+               && ( interval == TimeGranule::zero() || now - last_line_ < interval ) )
+            return false;
+          last_milestone_ = milestone;
+          last_line_      = now;
           return true;
         }
 
@@ -367,8 +606,27 @@ namespace pgbar {
         }
       };
       template<Channel Tag>
+      void Renderer<Tag>::rouse_all() noexcept
+      {
+        Renderer<Channel::Stdout>::rouse_observer();
+        Renderer<Channel::Stderr>::rouse_observer();
+      }
+      template<Channel Tag>
+      std::atomic<bool> Renderer<Tag>::_observing { false };
+      template<Channel Tag>
       std::atomic<TimeGranule> Renderer<Tag>::_working_interval { std::chrono::duration_cast<TimeGranule>(
         std::chrono::milliseconds( 40 ) ) };
+      template<Channel Tag>
+      std::atomic<TimeGranule> Renderer<Tag>::_signal_interval { TimeGranule::zero() };
+      template<Channel Tag>
+      std::atomic<TimeGranule> Renderer<Tag>::_min_interval { TimeGranule::zero() };
+      template<Channel Tag>
+      std::atomic<TimeGranule> Renderer<Tag>::_max_interval { TimeGranule::zero() };
+      template<Channel Tag>
+      std::atomic<TimeGranule> Renderer<Tag>::_log_interval { std::chrono::duration_cast<TimeGranule>(
+        std::chrono::seconds( 10 ) ) };
+      template<Channel Tag>
+      std::atomic<std::uint8_t> Renderer<Tag>::_log_milestone { 10 };
     } // namespace render
   } // namespace _details
 } // namespace pgbar
@@ -46,7 +46,7 @@ namespace pgbar {
         static constexpr std::ranges::iterator_t<U> check( int );
 #else
         template<typename U>
-        static constexpr decltype( std::begin( std::declval<U>() ) ) check( int );
+        static constexpr decltype( std::begin( std::declval<U&>() ) ) check( int );
 #endif
       public:
         using type = decltype( check<T>( 0 ) );
@@ -45,7 +45,7 @@ namespace pgbar {
 
   // A enum that specifies the type of the output stream.
   enum class Channel : int { Stdout = 1, Stderr = 2 };
-  enum class Policy : std::uint8_t { Async, Signal, Sync };
+  enum class Policy : std::uint8_t { Async, Signal, Sync, Throttle, External };
   enum class Region : bool { Fixed, Relative };
 
 #define PGBAR__DEFAULT 0xC105EA11 // C1O5E -> ClOSE, A11 -> All
@@ -3,6 +3,7 @@
 
 #include "../core/Core.hpp"
 #include "../traits/Backport.hpp"
+#include <algorithm>
 #include <cmath>
 #include <tuple>
 #ifdef __cpp_lib_to_chars
@@ -71,62 +72,100 @@ namespace pgbar {
         // Although, unfortunately, std::to_string is not labeled constexpr.
       }
 
-      // Format a finite floating point number.
+      /**
+       * Write an unsigned integer to the buffer starting at `first`, and return the end of what's written.
+       * The buffer must have room for `count_digits( val )` bytes.
+       */
+      template<typename Numeric>
+      PGBAR__FORCEINLINE PGBAR__CXX14_CNSTXPR
+        typename std::enable_if<std::is_unsigned<Numeric>::value, types::Char*>::type
+        format_to( types::Char* first, Numeric val ) noexcept
+      {
+        const auto last = first + count_digits( val );
+        auto itr        = last;
+        do {
+          *--itr = static_cast<types::Char>( '0' + val % 10 );
+          val /= 10;
+        } while ( val > 0 );
+        return last;
+      }
+
+      // The number of bytes that `format_to` may write for a floating point number.
       template<typename Floating>
-      PGBAR__NODISCARD typename std::enable_if<std::is_floating_point<Floating>::value, types::String>::type
-        format( Floating val, int precision = 3 ) noexcept( false )
+      PGBAR__NODISCARD PGBAR__FORCEINLINE
+        typename std::enable_if<std::is_floating_point<Floating>::value, types::Size>::type
+        format_size( Floating val, int precision ) noexcept
       {
-        /* Unlike the integer version,
-         * the std::to_string in the standard library does not provide a precision limit
-         * on floating-point numbers;
+        // The extra 2 is left for the decimal point and carry.
+        return std::signbit( val ) + count_digits( std::round( std::abs( val ) ) ) + precision + 2;
+      }
 
-         * So the implementation here is provided manually. */
+      /**
+       * Write a finite floating point number to the buffer starting at `first`,
+       * and return the end of what's written.
+       * The buffer must have room for `format_size( val, precision )` bytes.
+       */
+      template<typename Floating>
+      typename std::enable_if<std::is_floating_point<Floating>::value, types::Char*>::type format_to(
+        types::Char* first,
+        Floating val,
+        int precision = 3 ) noexcept
+      {
         PGBAR__ASSERT( std::isfinite( val ) );
         PGBAR__TRUST( precision >= 0 );
 #ifdef __cpp_lib_to_chars
-        const auto abs_rounded_val = std::round( std::abs( val ) );
-        const auto int_digits      = count_digits( abs_rounded_val );
-
-        types::String formatted;
-# ifdef __cpp_lib_string_resize_and_overwrite
-        formatted.resize_and_overwrite(
-          int_digits + precision + 2,
-          [val, precision]( types::Char* buf, types::Size n ) noexcept {
-            const auto result = std::to_chars( buf, buf + n, val, std::chars_format::fixed, precision );
-            PGBAR__TRUST( result.ec == std::errc() );
-            PGBAR__TRUST( result.ptr >= buf );
-            return static_cast<types::Size>( result.ptr - buf );
-          } );
-# else
-        formatted.resize( int_digits + precision + 2 );
-        // The extra 2 is left for the decimal point and carry.
-        const auto result = std::to_chars( formatted.data(),
-                                           formatted.data() + formatted.size(),
+        const auto result = std::to_chars( first,
+                                           first + format_size( val, precision ),
                                            val,
                                            std::chars_format::fixed,
                                            precision );
         PGBAR__TRUST( result.ec == std::errc() );
-        PGBAR__ASSERT( result.ptr >= formatted.data() );
-        formatted.resize( result.ptr - formatted.data() );
-# endif
+        PGBAR__TRUST( result.ptr >= first );
+        return result.ptr;
 #else
         const auto scale = static_cast<std::uint64_t>( std::pow( 10, precision ) );
         PGBAR__ASSERT( scale <= ( std::numeric_limits<std::uint64_t>::max )() );
         const auto scaled = static_cast<std::uint64_t>( std::round( scale * std::abs( val ) ) );
         PGBAR__ASSERT( scaled <= ( std::numeric_limits<std::uint64_t>::max )() );
-        const auto integer  = scaled / scale;
-        const auto fraction = scaled % scale;
-        const auto sign     = std::signbit( val );
 
-        auto formatted = types::String( sign, '-' );
-        formatted.reserve( count_digits( integer ) + sign + precision );
-        formatted.append( format( integer ) );
+        if ( std::signbit( val ) )
+          *first++ = '-';
+        first = format_to( first, scaled / scale );
         if ( precision > 0 ) {
-          formatted.push_back( '.' );
+          const auto fraction     = scaled % scale;
           const auto fract_digits = count_digits( fraction );
           PGBAR__TRUST( fract_digits <= static_cast<types::Size>( precision ) );
-          formatted.append( precision - fract_digits, '0' ).append( format( fraction ) );
+          *first++ = '.';
+          first    = std::fill_n( first, precision - fract_digits, '0' );
+          first    = format_to( first, fraction );
         }
+        return first;
+#endif
+      }
+
+      // Format a finite floating point number.
+      template<typename Floating>
+      PGBAR__NODISCARD typename std::enable_if<std::is_floating_point<Floating>::value, types::String>::type
+        format( Floating val, int precision = 3 ) noexcept( false )
+      {
+        /* Unlike the integer version,
+         * the std::to_string in the standard library does not provide a precision limit
+         * on floating-point numbers;
+
+         * So the implementation here is provided manually. */
+        PGBAR__ASSERT( std::isfinite( val ) );
+        PGBAR__TRUST( precision >= 0 );
+        const auto capacity = format_size( val, precision );
+
+        types::String formatted;
+#ifdef __cpp_lib_string_resize_and_overwrite
+        formatted.resize_and_overwrite( capacity, [val, precision]( types::Char* buf, types::Size ) noexcept {
+          return static_cast<types::Size>( format_to( buf, val, precision ) - buf );
+        } );
+#else
+        formatted.resize( capacity );
+        const auto last = format_to( &formatted[0], val, precision );
+        formatted.resize( static_cast<types::Size>( last - formatted.data() ) );
 #endif
         return formatted;
       }
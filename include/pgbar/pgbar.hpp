@@ -15,6 +15,8 @@
 # include "DynamicBar.hpp"
 # include "MultiBar.hpp"
 
+# include "Parallel.hpp"
+
 # undef PGBAR__BIND_BEHAVIOUR
 # undef PGBAR__BIND_OPTION
 
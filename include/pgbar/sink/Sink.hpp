@@ -0,0 +1,260 @@
+#ifndef PGBAR_SINK
+#define PGBAR_SINK
+
+#include "../details/io/Descriptor.hpp"
+#include "../details/wrappers/UniqueFunction.hpp"
+#include "../exception/Error.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace pgbar {
+  namespace sink {
+    /**
+     * The destination that a channel writes its frames to, in place of `stdout` or `stderr`.
+     *
+     * The frames are handed to `write` in UTF-8 by the writer thread of the channel,
+     * so a sink that is registered on both channels must be safe to write from two threads.
+     */
+    class Sink {
+    public:
+      virtual ~Sink() = default;
+
+      // Write all the bytes, or throw if it can't.
+      virtual void write( const _details::types::Char* data, _details::types::Size size ) = 0;
+
+      // Whether the destination is a terminal, which decides whether the frames carry cursor movements.
+      PGBAR__NODISCARD virtual bool tty() const noexcept { return false; }
+      // The width of the terminal in columns, or zero if it isn't known.
+      PGBAR__NODISCARD virtual std::uint16_t width() const noexcept { return 0; }
+      // Whether the destination hasn't taken what was written before, see `config::backpressure`.
+      PGBAR__NODISCARD virtual bool behind() const noexcept { return false; }
+    };
+
+#if PGBAR__WIN || PGBAR__UNIX
+    /**
+     * Write to an open file descriptor, such as a dedicated `/dev/tty`, a log file or a socket.
+     *
+     * The descriptor isn't owned by the sink, it's up to the caller to keep it open.
+     */
+    class FdSink final : public Sink {
+      int fd_;
+
+    public:
+      explicit FdSink( int fd ) noexcept : fd_ { fd } {}
+      ~FdSink() override = default;
+
+      void write( const _details::types::Char* data, _details::types::Size size ) override
+      {
+        _details::io::write_all( fd_, data, size );
+      }
+      PGBAR__NODISCARD bool tty() const noexcept override { return _details::io::is_terminal( fd_ ); }
+      PGBAR__NODISCARD std::uint16_t width() const noexcept override
+      {
+        return _details::io::columns( fd_ );
+      }
+      PGBAR__NODISCARD bool behind() const noexcept override { return _details::io::lagging( fd_ ); }
+
+      PGBAR__NODISCARD int fd() const noexcept { return fd_; }
+    };
+#endif
+
+    /**
+     * Pass every frame to a callback, which receives the bytes and their length.
+     *
+     * @throw exception::InvalidArgument
+     *
+     * If the callback is empty.
+     */
+    class CallbackSink final : public Sink {
+    public:
+      using Callback =
+        _details::wrappers::UniqueFunction<void( const _details::types::Char*, _details::types::Size )>;
+
+    private:
+      Callback callback_;
+      bool tty_;
+
+    public:
+      /**
+       * @param as_tty
+       * Whether the frames are meant for a terminal,
+       * in which case they move the cursor to redraw the bars in place.
+       */
+      explicit CallbackSink( Callback callback, bool as_tty = false ) noexcept( false )
+        : callback_ { std::move( callback ) }, tty_ { as_tty }
+      {
+        if ( callback_ == nullptr )
+          PGBAR__UNLIKELY throw exception::InvalidArgument(
+            _details::charcodes::make_literal( "pgbar: the callback of a sink is empty" ) );
+      }
+      ~CallbackSink() override = default;
+
+      void write( const _details::types::Char* data, _details::types::Size size ) override
+      {
+        callback_( data, size );
+      }
+      PGBAR__NODISCARD bool tty() const noexcept override { return tty_; }
+    };
+
+    // Collect the frames in memory, for tests or for forwarding them somewhere else later.
+    class MemorySink final : public Sink {
+      _details::types::String bytes_;
+      mutable std::mutex mtx_;
+      bool tty_;
+
+    public:
+      // `as_tty` tells whether the frames are meant for a terminal, as in `CallbackSink`.
+      explicit MemorySink( bool as_tty = false ) noexcept : tty_ { as_tty } {}
+      ~MemorySink() override = default;
+
+      void write( const _details::types::Char* data, _details::types::Size size ) override
+      {
+        std::lock_guard<std::mutex> lock { mtx_ };
+        bytes_.append( data, size );
+      }
+      PGBAR__NODISCARD bool tty() const noexcept override { return tty_; }
+
+      // Get a copy of the bytes collected so far.
+      PGBAR__NODISCARD _details::types::String str() const
+      {
+        std::lock_guard<std::mutex> lock { mtx_ };
+        return bytes_;
+      }
+      // Take the bytes collected so far, leaving the sink empty.
+      PGBAR__NODISCARD _details::types::String take()
+      {
+        std::lock_guard<std::mutex> lock { mtx_ };
+        _details::types::String ret;
+        ret.swap( bytes_ );
+        return ret;
+      }
+    };
+
+    /**
+     * Record the size and the time of every frame, to measure the output without a terminal.
+     *
+     * The records of the latest `capacity` frames are kept in a ring allocated up front,
+     * while the statistics cover every frame written since the last `reset`.
+     */
+    class CaptureSink final : public Sink {
+    public:
+      using Clock = std::chrono::steady_clock;
+
+      struct Record {
+        Clock::time_point stamp_;
+        _details::types::Size size_;
+      };
+      struct Stats {
+        std::uint64_t frames_ = 0;
+        std::uint64_t bytes_  = 0;
+        // The byte size of a single frame.
+        _details::types::Size min_size_ = 0, max_size_ = 0, mean_size_ = 0;
+        // The gaps between two consecutive frames.
+        TimeGranule min_gap_ {}, max_gap_ {}, mean_gap_ {};
+        // The number of frames that follow a `mark`, and the time they took to be written after it.
+        std::uint64_t marked_ = 0;
+        TimeGranule min_latency_ {}, max_latency_ {}, mean_latency_ {};
+      };
+
+    private:
+      std::vector<Record> ring_;
+      _details::types::Size head_;
+      Stats stats_;
+      TimeGranule total_gap_, total_latency_;
+      Clock::time_point last_stamp_;
+      std::atomic<Clock::rep> last_mark_;
+      mutable std::mutex mtx_;
+      bool tty_;
+
+    public:
+      // `as_tty` tells whether the frames are meant for a terminal, as in `CallbackSink`.
+      explicit CaptureSink( _details::types::Size capacity = 1024, bool as_tty = false ) noexcept( false )
+        : ring_( capacity ), head_ { 0 }, last_mark_ { 0 }, tty_ { as_tty }
+      {
+        reset();
+      }
+      ~CaptureSink() override = default;
+
+      void write( const _details::types::Char*, _details::types::Size size ) override
+      {
+        const auto now  = Clock::now();
+        const auto mark = last_mark_.exchange( 0, std::memory_order_relaxed );
+
+        std::lock_guard<std::mutex> lock { mtx_ };
+        if ( !ring_.empty() ) {
+          ring_[head_ % ring_.size()] = { now, size };
+          ++head_;
+        }
+        if ( stats_.frames_ != 0 ) {
+          const auto gap  = std::chrono::duration_cast<TimeGranule>( now - last_stamp_ );
+          stats_.min_gap_ = stats_.frames_ == 1 ? gap : ( std::min )( stats_.min_gap_, gap );
+          stats_.max_gap_ = ( std::max )( stats_.max_gap_, gap );
+          total_gap_ += gap;
+        }
+        if ( mark != 0 ) {
+          const auto latency =
+            std::chrono::duration_cast<TimeGranule>( now - Clock::time_point( Clock::duration( mark ) ) );
+          stats_.min_latency_ = stats_.marked_ == 0 ? latency : ( std::min )( stats_.min_latency_, latency );
+          stats_.max_latency_ = ( std::max )( stats_.max_latency_, latency );
+          total_latency_ += latency;
+          ++stats_.marked_;
+        }
+        stats_.min_size_ = stats_.frames_ == 0 ? size : ( std::min )( stats_.min_size_, size );
+        stats_.max_size_ = ( std::max )( stats_.max_size_, size );
+        ++stats_.frames_;
+        stats_.bytes_ += size;
+        last_stamp_ = now;
+      }
+      PGBAR__NODISCARD bool tty() const noexcept override { return tty_; }
+
+      /**
+       * Mark the moment of a tick; the next frame written measures its latency from the latest mark
+       * made since the frame before it.
+       */
+      void mark() noexcept
+      {
+        last_mark_.exchange( Clock::now().time_since_epoch().count(), std::memory_order_relaxed );
+      }
+
+      PGBAR__NODISCARD Stats stats() const
+      {
+        std::lock_guard<std::mutex> lock { mtx_ };
+        auto ret = stats_;
+        if ( ret.frames_ != 0 )
+          ret.mean_size_ = static_cast<_details::types::Size>( ret.bytes_ / ret.frames_ );
+        if ( ret.frames_ > 1 )
+          ret.mean_gap_ = total_gap_ / static_cast<TimeGranule::rep>( ret.frames_ - 1 );
+        if ( ret.marked_ != 0 )
+          ret.mean_latency_ = total_latency_ / static_cast<TimeGranule::rep>( ret.marked_ );
+        return ret;
+      }
+      // Get the records kept in the ring, from the oldest to the latest.
+      PGBAR__NODISCARD std::vector<Record> records() const
+      {
+        std::lock_guard<std::mutex> lock { mtx_ };
+        const auto num_kept = ( std::min )( head_, ring_.size() );
+        std::vector<Record> ret;
+        ret.reserve( num_kept );
+        for ( auto i = head_ - num_kept; i < head_; ++i )
+          ret.push_back( ring_[i % ring_.size()] );
+        return ret;
+      }
+      // Drop the records and the statistics, and the pending mark.
+      void reset() noexcept
+      {
+        std::lock_guard<std::mutex> lock { mtx_ };
+        head_          = 0;
+        stats_         = Stats();
+        total_gap_     = TimeGranule::zero();
+        total_latency_ = TimeGranule::zero();
+        last_mark_.store( 0, std::memory_order_relaxed );
+      }
+    };
+  } // namespace sink
+} // namespace pgbar
+
+#endif
@@ -4,6 +4,7 @@
 #include "../details/prefabs/BasicBar.hpp"
 #include "../details/traits/ConceptTraits.hpp"
 #include "../details/traits/Util.hpp"
+#include <algorithm>
 #ifdef __cpp_lib_ranges
 # include <ranges>
 #endif
@@ -31,6 +32,7 @@ namespace pgbar {
 
       UIRef ui_;
       View view_;
+      std::uint64_t stride_ = 1;
 
       using Itr = _details::traits::IteratorOf_t<View>;
       using Snt = _details::traits::SentinelOf_t<View>;
@@ -40,6 +42,7 @@ namespace pgbar {
         Snt snt_;
 
       public:
+        constexpr Sentry() = default;
         constexpr Sentry( Snt endpoint, UIRef ui_ref )
           noexcept( _details::traits::AllOf<std::is_nothrow_move_constructible<Snt>,
                                             std::is_nothrow_move_constructible<UIRef>>::value )
@@ -52,6 +55,22 @@ namespace pgbar {
       class iterator {
         UIRef ui_;
         Itr itr_;
+        // The bar is ticked once every `stride_` elements, and `remains_` counts the elements not ticked yet.
+        std::uint64_t stride_    = 1;
+        std::uint64_t remains_   = 0;
+        std::uint64_t countdown_ = 0;
+
+        // Only reached once every `stride_` elements, so it stays out of the inlined `operator++`.
+        PGBAR__NOINLINE void tick_chunk() &
+        {
+          const auto chunk = (std::min)( stride_, remains_ );
+          remains_ -= chunk;
+          countdown_ = (std::min)( stride_, remains_ );
+          if ( chunk == 1 )
+            ui_->tick();
+          else
+            ui_->tick( chunk );
+        }
 
       public:
         using iterator_category = typename std::conditional<
@@ -69,18 +88,38 @@ namespace pgbar {
                                             std::is_nothrow_move_constructible<UIRef>>::value )
           : ui_ { std::move( ui_ref ) }, itr_ { std::move( itr ) }
         {}
+        PGBAR__CXX17_CNSTXPR iterator( Itr itr, UIRef ui_ref, std::uint64_t stride, std::uint64_t size )
+          noexcept( _details::traits::AllOf<std::is_nothrow_move_constructible<Itr>,
+                                            std::is_nothrow_move_constructible<UIRef>>::value )
+          : ui_ { std::move( ui_ref ) }
+          , itr_ { std::move( itr ) }
+          , stride_ { stride }
+          , remains_ { size }
+          , countdown_ { (std::min)( stride, size ) }
+        {
+          PGBAR__TRUST( stride > 0 );
+        }
+        constexpr iterator( const iterator& )                      = default;
+        PGBAR__CXX14_CNSTXPR iterator& operator=( const iterator& ) & = default;
         PGBAR__CXX17_CNSTXPR iterator( iterator&& rhs )
           noexcept( _details::traits::AllOf<std::is_nothrow_move_constructible<View>,
                                             std::is_nothrow_move_constructible<UIRef>>::value )
           : iterator( std::move( rhs.itr_ ), std::move( rhs.ui_ ) )
-        {}
+        {
+          stride_    = rhs.stride_;
+          remains_   = rhs.remains_;
+          countdown_ = rhs.countdown_;
+        }
         PGBAR__CXX17_CNSTXPR iterator& operator=( iterator&& rhs ) & noexcept(
           _details::traits::AllOf<std::is_nothrow_move_assignable<View>,
                                   std::is_nothrow_move_assignable<UIRef>>::value )
         {
           PGBAR__TRUST( this != &rhs );
-          itr_ = std::move( rhs.itr_ );
-          ui_  = std::move( rhs.ui_ );
+          itr_       = std::move( rhs.itr_ );
+          ui_        = std::move( rhs.ui_ );
+          stride_    = rhs.stride_;
+          remains_   = rhs.remains_;
+          countdown_ = rhs.countdown_;
           return *this;
         }
         PGBAR__CXX20_CNSTXPR ~iterator() = default;
@@ -88,7 +127,11 @@ namespace pgbar {
         PGBAR__FORCEINLINE PGBAR__CXX14_CNSTXPR iterator& operator++() &
         {
           itr_ = std::next( itr_, 1 );
-          ui_->tick();
+          // The default stride ticks the bar directly, and leaves the bookkeeping to the chunked strides.
+          if ( stride_ == 1 )
+            ui_->tick();
+          else if ( --countdown_ == 0 )
+            PGBAR__UNLIKELY tick_chunk();
           return *this;
         }
         PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX14_CNSTXPR iterator operator++( int ) &
@@ -202,14 +245,17 @@ namespace pgbar {
         noexcept( _details::traits::AllOf<std::is_nothrow_move_constructible<View>,
                                           std::is_nothrow_move_constructible<UIRef>>::value )
         : TrackedSpan( std::move( rhs.view_ ), std::move( rhs.ui_ ) )
-      {}
+      {
+        stride_ = rhs.stride_;
+      }
       PGBAR__CXX17_CNSTXPR TrackedSpan& operator=( TrackedSpan&& rhs ) & noexcept(
         _details::traits::AllOf<std::is_nothrow_move_constructible<View>,
                                 std::is_nothrow_move_constructible<UIRef>>::value )
       {
         PGBAR__TRUST( this != &rhs );
-        view_ = std::move( rhs.view_ );
-        ui_   = std::move( rhs.ui_ );
+        view_   = std::move( rhs.view_ );
+        ui_     = std::move( rhs.ui_ );
+        stride_ = rhs.stride_;
         return *this;
       }
       // Intentional non-virtual destructors.
@@ -228,6 +274,29 @@ namespace pgbar {
         return _details::utils::exchange( ui_, ui );
       }
 
+      /**
+       * Tick the bar once every `num` elements instead of once per element,
+       * and tick the remainder when the last element is reached.
+
+       * It's meant for loops over a lot of cheap elements; a `num` of zero is treated as one.
+       */
+      PGBAR__CXX14_CNSTXPR TrackedSpan& stride( std::uint64_t num ) & noexcept
+      {
+        stride_ = num == 0 ? 1 : num;
+        return *this;
+      }
+      // Returns by value, so that a temporary span in a range-for statement doesn't dangle.
+      PGBAR__CXX14_CNSTXPR TrackedSpan stride( std::uint64_t num ) && noexcept(
+        std::is_nothrow_move_constructible<TrackedSpan>::value )
+      {
+        stride( num );
+        return std::move( *this );
+      }
+      PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX17_CNSTXPR std::uint64_t stride() const noexcept
+      {
+        return stride_;
+      }
+
       PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX17_CNSTXPR bool empty() const noexcept
       {
         return view_.empty() && static_cast<bool>( ui_ );
@@ -235,8 +304,9 @@ namespace pgbar {
       // This function will CHANGE the state of the pgbar object it holds.
       PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX17_CNSTXPR iterator begin() &
       {
-        ui_->config().tasks( _details::utils::size( view_ ) );
-        return { _details::utils::begin( view_ ), ui_ };
+        const auto size = static_cast<std::uint64_t>( _details::utils::size( view_ ) );
+        ui_->config().tasks( size );
+        return { _details::utils::begin( view_ ), ui_, stride_, size };
       }
       PGBAR__NODISCARD PGBAR__FORCEINLINE PGBAR__CXX17_CNSTXPR sentinel end() const
       {
@@ -249,6 +319,7 @@ namespace pgbar {
         using std::swap;
         std::swap( ui_, lhs.ui_ );
         swap( view_, lhs.view_ );
+        std::swap( stride_, lhs.stride_ );
       }
       friend PGBAR__CXX14_CNSTXPR void swap( TrackedSpan& a, TrackedSpan& b ) noexcept { a.swap( b ); }
 
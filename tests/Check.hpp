@@ -0,0 +1,16 @@
+#ifndef PGBAR_TESTS_CHECK
+#define PGBAR_TESTS_CHECK
+
+#include <cstdio>
+#include <cstdlib>
+
+// Report the condition that doesn't hold and leave, so that CTest marks the test as failed.
+#define PGBAR_CHECK( condition )                                                              \
+  do {                                                                                        \
+    if ( !( condition ) ) {                                                                   \
+      std::fprintf( stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition ); \
+      std::exit( EXIT_FAILURE );                                                              \
+    }                                                                                         \
+  } while ( false )
+
+#endif
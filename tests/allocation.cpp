@@ -0,0 +1,108 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+namespace {
+  std::atomic<std::uint64_t> num_allocations { 0 };
+
+  void* allocate( std::size_t size )
+  {
+    num_allocations.fetch_add( 1, std::memory_order_relaxed );
+    if ( void* ptr = std::malloc( size != 0 ? size : 1 ) )
+      return ptr;
+    throw std::bad_alloc();
+  }
+} // namespace
+
+// Count every allocation made by the program.
+void* operator new( std::size_t size )
+{
+  return allocate( size );
+}
+void* operator new[]( std::size_t size )
+{
+  return allocate( size );
+}
+void operator delete( void* ptr ) noexcept
+{
+  std::free( ptr );
+}
+void operator delete[]( void* ptr ) noexcept
+{
+  std::free( ptr );
+}
+void operator delete( void* ptr, std::size_t ) noexcept
+{
+  std::free( ptr );
+}
+void operator delete[]( void* ptr, std::size_t ) noexcept
+{
+  std::free( ptr );
+}
+#ifdef __cpp_aligned_new
+void* operator new( std::size_t size, std::align_val_t align )
+{
+  num_allocations.fetch_add( 1, std::memory_order_relaxed );
+  const auto alignment = static_cast<std::size_t>( align );
+  if ( void* ptr = std::aligned_alloc( alignment, ( size + alignment - 1 ) / alignment * alignment ) )
+    return ptr;
+  throw std::bad_alloc();
+}
+void operator delete( void* ptr, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+void operator delete( void* ptr, std::size_t, std::align_val_t ) noexcept
+{
+  std::free( ptr );
+}
+#endif
+
+/**
+ * Run a synchronous bar showing every component into a sink of `as_tty`,
+ * and return the number of allocations made by the frames after the first ones.
+ */
+std::uint64_t allocations_of( bool as_tty )
+{
+  auto num_bytes = std::make_shared<std::atomic<std::uint64_t>>( 0 );
+  pgbar::config::sink<pgbar::Channel::Stdout>( std::make_shared<pgbar::sink::CallbackSink>(
+    [num_bytes]( const char*, std::size_t size ) { num_bytes->fetch_add( size ); },
+    as_tty ) );
+
+  constexpr std::uint64_t num_tasks = 20000, num_warmups = 1000;
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Sync> bar {
+    pgbar::option::Style( pgbar::config::Line::Entire ),
+    pgbar::option::Tasks( num_tasks ),
+    pgbar::option::Prefix( "进度" ),
+    pgbar::option::InfoColor( "#F7A699" ) };
+  for ( std::uint64_t i = 0; i < num_warmups; ++i )
+    bar.tick();
+  const auto num_bytes_before = num_bytes->load();
+  const auto before           = num_allocations.load();
+  for ( std::uint64_t i = num_warmups; i + 1 < num_tasks; ++i )
+    bar.tick();
+  const auto after = num_allocations.load();
+  // The counter is visible, so each tick did write a frame in the meanwhile.
+  PGBAR_CHECK( num_bytes->load() - num_bytes_before > num_tasks - num_warmups );
+  bar.tick();
+  PGBAR_CHECK( !bar.active() );
+  return after - before;
+}
+
+int main()
+{
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  pgbar::config::writer_thread( false );
+
+  PGBAR_CHECK( allocations_of( false ) == 0 );
+  // The frames to a terminal go through the damage tracker as well.
+  PGBAR_CHECK( allocations_of( true ) == 0 );
+  // The bars did allocate when they started, so the counting works.
+  PGBAR_CHECK( num_allocations.load() != 0 );
+  return 0;
+}
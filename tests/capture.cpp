@@ -0,0 +1,58 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+// Drive the same progress bar into a `MemorySink` and a `CaptureSink`, and check what they received.
+template<pgbar::Channel Outlet>
+void run( std::uint64_t num_tasks, bool marked )
+{
+  pgbar::ProgressBar<Outlet, pgbar::Policy::Sync> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ) };
+  auto capture = std::dynamic_pointer_cast<pgbar::sink::CaptureSink>( pgbar::config::sink<Outlet>() );
+  for ( std::uint64_t i = 0; i < num_tasks; ++i ) {
+    if ( marked && capture != nullptr )
+      capture->mark();
+    bar.tick();
+  }
+  PGBAR_CHECK( !bar.active() );
+}
+
+int main()
+{
+  constexpr std::uint64_t num_tasks = 200;
+  auto memory  = std::make_shared<pgbar::sink::MemorySink>();
+  auto capture = std::make_shared<pgbar::sink::CaptureSink>( num_tasks * 2 );
+  pgbar::config::sink<pgbar::Channel::Stdout>( memory );
+  pgbar::config::sink<pgbar::Channel::Stderr>( capture );
+  // Every frame is written as a line, as neither the time nor the milestones hold any back.
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  pgbar::config::writer_thread( false );
+
+  run<pgbar::Channel::Stdout>( num_tasks, false );
+  run<pgbar::Channel::Stderr>( num_tasks, true );
+
+  const auto bytes     = memory->str();
+  const auto num_lines = static_cast<std::uint64_t>( std::count( bytes.cbegin(), bytes.cend(), '\n' ) );
+  const auto stats     = capture->stats();
+  // One frame for the start, one per tick but the last, and one for the end.
+  PGBAR_CHECK( num_lines == num_tasks + 1 );
+  PGBAR_CHECK( bytes.find( "200/200" ) != bytes.npos );
+  PGBAR_CHECK( stats.frames_ == num_lines );
+  PGBAR_CHECK( stats.bytes_ == bytes.size() );
+  PGBAR_CHECK( stats.min_size_ > 0 && stats.min_size_ <= stats.mean_size_ );
+  PGBAR_CHECK( stats.mean_size_ <= stats.max_size_ );
+  PGBAR_CHECK( capture->records().size() == stats.frames_ );
+
+  // Each tick is marked, and the frame it causes is written before the tick returns.
+  PGBAR_CHECK( stats.marked_ == num_tasks );
+  PGBAR_CHECK( stats.min_latency_ <= stats.mean_latency_ && stats.mean_latency_ <= stats.max_latency_ );
+  PGBAR_CHECK( stats.max_latency_ < std::chrono::seconds( 1 ) );
+
+  capture->reset();
+  PGBAR_CHECK( capture->stats().frames_ == 0 && capture->records().empty() );
+  return 0;
+}
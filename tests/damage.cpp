@@ -0,0 +1,231 @@
+#include "pgbar/BlockBar.hpp"
+#include "pgbar/MultiBar.hpp"
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+// A terminal that understands what the bars write: the glyphs, SGR, and the cursor movements.
+class Screen {
+  struct Style {
+    std::string fg_, bg_;
+    std::uint32_t flags_ = 0; // bold, faint, italic and so on, by their SGR numbers
+
+    bool operator==( const Style& other ) const
+    {
+      return fg_ == other.fg_ && bg_ == other.bg_ && flags_ == other.flags_;
+    }
+  };
+  struct Cell {
+    std::string glyph_; // empty if the cell is blank, or is covered by a wide glyph before it
+    Style style_;
+
+    bool operator==( const Cell& other ) const
+    {
+      return glyph_ == other.glyph_ && ( glyph_.empty() || style_ == other.style_ );
+    }
+  };
+
+  std::vector<std::vector<Cell>> rows_;
+  std::size_t row_ = 0, column_ = 0, saved_row_ = 0, saved_column_ = 0;
+  Style style_;
+
+  Cell& at( std::size_t row, std::size_t column )
+  {
+    if ( rows_.size() <= row )
+      rows_.resize( row + 1 );
+    if ( rows_[row].size() <= column )
+      rows_[row].resize( column + 1 );
+    return rows_[row][column];
+  }
+
+  void select( const std::vector<int>& params )
+  {
+    for ( std::size_t i = 0; i < params.size(); ++i ) {
+      const auto param = params[i];
+      if ( param == 0 )
+        style_ = Style();
+      else if ( param < 10 )
+        style_.flags_ |= 1u << param;
+      else if ( param == 22 )
+        style_.flags_ &= ~( ( 1u << 1 ) | ( 1u << 2 ) );
+      else if ( param > 22 && param < 30 )
+        style_.flags_ &= ~( 1u << ( param - 20 ) );
+      else if ( ( param >= 30 && param <= 39 ) || ( param >= 90 && param <= 97 ) ) {
+        auto& color = style_.fg_;
+        color       = param == 39 ? std::string() : std::to_string( param );
+        // The extended colors take their components from the following parameters.
+        for ( auto num_args = param != 38 ? 0 : i + 1 < params.size() && params[i + 1] == 2 ? 4 : 2;
+              num_args != 0 && i + 1 < params.size();
+              --num_args )
+          color += ';' + std::to_string( params[++i] );
+      } else if ( ( param >= 40 && param <= 49 ) || ( param >= 100 && param <= 107 ) ) {
+        auto& color = style_.bg_;
+        color       = param == 49 ? std::string() : std::to_string( param );
+        for ( auto num_args = param != 48 ? 0 : i + 1 < params.size() && params[i + 1] == 2 ? 4 : 2;
+              num_args != 0 && i + 1 < params.size();
+              --num_args )
+          color += ';' + std::to_string( params[++i] );
+      }
+    }
+  }
+
+public:
+  void write( const std::string& bytes )
+  {
+    for ( std::size_t pos = 0; pos < bytes.size(); ) {
+      const auto ch = static_cast<unsigned char>( bytes[pos] );
+      if ( ch == '\r' ) {
+        column_ = 0;
+        ++pos;
+      } else if ( ch == '\n' ) {
+        ++row_;
+        column_ = 0;
+        ++pos;
+      } else if ( ch == '\x1B' ) {
+        PGBAR_CHECK( pos + 1 < bytes.size() && bytes[pos + 1] == '[' );
+        pos += 2;
+        const bool priv = pos < bytes.size() && bytes[pos] == '?';
+        pos += priv;
+        std::vector<int> params { 0 };
+        for ( ; pos < bytes.size() && ( std::isdigit( bytes[pos] ) || bytes[pos] == ';' ); ++pos )
+          if ( bytes[pos] == ';' )
+            params.push_back( 0 );
+          else
+            params.back() = params.back() * 10 + ( bytes[pos] - '0' );
+        PGBAR_CHECK( pos < bytes.size() );
+        const auto command = bytes[pos++];
+        if ( priv )
+          continue; // showing or hiding the cursor
+        switch ( command ) {
+        case 'm': select( params ); break;
+        case 'A':
+          row_ -= ( std::min )( row_, static_cast<std::size_t>( ( std::max )( params[0], 1 ) ) );
+          break;
+        case 'G': column_ = static_cast<std::size_t>( ( std::max )( params[0], 1 ) - 1 ); break;
+        case 'K':
+          PGBAR_CHECK( params[0] == 0 );
+          if ( row_ < rows_.size() && column_ < rows_[row_].size() )
+            rows_[row_].resize( column_ );
+          break;
+        case 's':
+          saved_row_    = row_;
+          saved_column_ = column_;
+          break;
+        case 'u':
+          row_    = saved_row_;
+          column_ = saved_column_;
+          break;
+        default: PGBAR_CHECK( !"an unexpected control sequence" );
+        }
+      } else {
+        std::size_t length = ch < 0x80 ? 1 : ( ch & 0xE0 ) == 0xC0 ? 2 : ( ch & 0xF0 ) == 0xE0 ? 3 : 4;
+        char32_t codepoint = length == 1 ? ch : ch & ( 0x7F >> length );
+        for ( std::size_t i = 1; i < length; ++i )
+          codepoint = ( codepoint << 6 ) | ( static_cast<unsigned char>( bytes[pos + i] ) & 0x3F );
+        const auto glyph = bytes.substr( pos, length );
+        const auto width = pgbar::_details::charcodes::U8Raw::glyph_width( codepoint );
+        pos += length;
+        if ( width == 0 ) {
+          PGBAR_CHECK( column_ > 0 );
+          at( row_, column_ - 1 ).glyph_ += glyph;
+          continue;
+        }
+        at( row_, column_ ) = { glyph, style_ };
+        for ( std::size_t i = 1; i < width; ++i )
+          at( row_, column_ + i ) = Cell();
+        column_ += width;
+      }
+    }
+  }
+
+  bool operator==( const Screen& other ) const
+  {
+    const auto num_rows = ( std::max )( rows_.size(), other.rows_.size() );
+    for ( std::size_t i = 0; i < num_rows; ++i ) {
+      const auto& mine   = i < rows_.size() ? rows_[i] : std::vector<Cell>();
+      const auto& theirs = i < other.rows_.size() ? other.rows_[i] : std::vector<Cell>();
+      for ( std::size_t j = 0; j < ( std::max )( mine.size(), theirs.size() ); ++j )
+        if ( !( ( j < mine.size() ? mine[j] : Cell() ) == ( j < theirs.size() ? theirs[j] : Cell() ) ) )
+          return false;
+    }
+    return row_ == other.row_ && column_ == other.column_;
+  }
+};
+
+// Run a multi-line bar synchronously, and return every frame it writes.
+std::vector<std::string> frames_of( bool damage_tracking )
+{
+  auto frames = std::make_shared<std::vector<std::string>>();
+  pgbar::config::sink<pgbar::Channel::Stdout>( std::make_shared<pgbar::sink::CallbackSink>(
+    [frames]( const char* data, std::size_t size ) { frames->emplace_back( data, size ); },
+    true ) );
+  pgbar::config::damage_tracking<pgbar::Channel::Stdout>( damage_tracking );
+
+  constexpr std::uint64_t num_tasks = 300;
+  auto bars                         = pgbar::make_multi<pgbar::Channel::Stdout, pgbar::Policy::Sync>(
+    pgbar::config::Block(
+      pgbar::option::Style( pgbar::config::Block::Per | pgbar::config::Block::Ani
+                            | pgbar::config::Block::Cnt ),
+      pgbar::option::Tasks( num_tasks ),
+      pgbar::option::Prefix( "块 " ),
+      pgbar::option::InfoColor( "#F7A699" ) ),
+    pgbar::config::Line( pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+                         pgbar::option::Tasks( num_tasks / 3 ),
+                         pgbar::option::PrefixColor( pgbar::Color::Red ) ) );
+  for ( std::uint64_t i = 0; i < num_tasks; ++i ) {
+    // A shorter row leaves its old tail to be wiped.
+    if ( i == num_tasks / 2 )
+      bars.config<0>().prefix( "" );
+    bars.tick<0>();
+    if ( i % 3 == 0 )
+      bars.tick<1>();
+  }
+  PGBAR_CHECK( !bars.active() );
+  return std::move( *frames );
+}
+
+std::size_t size_of( const std::vector<std::string>& frames )
+{
+  std::size_t ret = 0;
+  for ( const auto& frame : frames )
+    ret += frame.size();
+  return ret;
+}
+
+int main()
+{
+  pgbar::config::writer_thread( false );
+
+  // Each rewritten frame, including the keyframes, leaves the same screen as the original one.
+  const auto full = frames_of( false );
+  PGBAR_CHECK( full.size() > 64 * 2 );
+  Screen redrawn, edited;
+  pgbar::_details::io::DamageTracker tracker;
+  std::size_t num_edited = 0, num_edited_bytes = 0;
+  for ( const auto& frame : full ) {
+    std::vector<char> edits( frame.cbegin(), frame.cend() );
+    tracker.rewrite( edits );
+    redrawn.write( frame );
+    edited.write( std::string( edits.cbegin(), edits.cend() ) );
+    PGBAR_CHECK( redrawn == edited );
+    num_edited += edits.size() < frame.size();
+    num_edited_bytes += edits.size();
+  }
+  PGBAR_CHECK( num_edited > full.size() / 2 );
+  PGBAR_CHECK( num_edited_bytes < size_of( full ) );
+
+  // The same holds for the frames that the stream rewrites by itself.
+  const auto tracked = frames_of( true );
+  Screen shown;
+  for ( const auto& frame : tracked )
+    shown.write( frame );
+  PGBAR_CHECK( shown == redrawn );
+  PGBAR_CHECK( size_of( tracked ) < size_of( full ) );
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <cstdint>
+#include <memory>
+#ifdef __linux__
+# include <dirent.h>
+#endif
+
+// Return the number of threads running in this process, or 0 if it's unknown.
+std::uint64_t num_threads()
+{
+  std::uint64_t ret = 0;
+#ifdef __linux__
+  if ( DIR* dir = opendir( "/proc/self/task" ) ) {
+    while ( const dirent* entry = readdir( dir ) )
+      ret += entry->d_name[0] != '.';
+    closedir( dir );
+  }
+#endif
+  return ret;
+}
+
+int main()
+{
+  auto capture = std::make_shared<pgbar::sink::CaptureSink>( 0 );
+  pgbar::config::sink<pgbar::Channel::Stderr>( capture );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+
+  const auto num_idle = num_threads();
+  pgbar::config::enabled( false );
+  PGBAR_CHECK( !pgbar::config::enabled() );
+  {
+    constexpr std::uint64_t num_tasks = 1000;
+    pgbar::ProgressBar<> bar { pgbar::option::Tasks( num_tasks ) };
+    for ( std::uint64_t i = 0; i < num_tasks / 2; ++i ) {
+      bar.tick();
+      // The bar is never activated, so no renderer is launched for it.
+      PGBAR_CHECK( !bar.active() );
+    }
+    bar.tick_to( 90 );
+    PGBAR_CHECK( !bar.active() );
+    PGBAR_CHECK( num_threads() == num_idle );
+
+    std::uint64_t num_visited = 0;
+    for ( auto i : bar.iterate( num_tasks ) ) {
+      (void)i;
+      ++num_visited;
+    }
+    PGBAR_CHECK( num_visited == num_tasks );
+    PGBAR_CHECK( !bar.active() );
+  }
+  // Nothing was ever written.
+  PGBAR_CHECK( capture->stats().frames_ == 0 );
+
+  // Turning the switch back on restores the usual behavior.
+  pgbar::config::enabled( true );
+  {
+    pgbar::ProgressBar<> bar { pgbar::option::Tasks( 10 ) };
+    bar.tick();
+    PGBAR_CHECK( bar.active() );
+    bar.tick_to( 100 );
+    PGBAR_CHECK( !bar.active() );
+  }
+  PGBAR_CHECK( capture->stats().frames_ != 0 );
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The threads that the frames have been written from.
+struct Writers {
+  std::mutex mtx_;
+  std::vector<std::thread::id> ids_;
+
+  std::size_t size()
+  {
+    std::lock_guard<std::mutex> lock { mtx_ };
+    return ids_.size();
+  }
+};
+
+int main()
+{
+  auto writers = std::make_shared<Writers>();
+  pgbar::config::sink<pgbar::Channel::Stdout>(
+    std::make_shared<pgbar::sink::CallbackSink>( [writers]( const char*, std::size_t ) {
+      std::lock_guard<std::mutex> lock { writers->mtx_ };
+      writers->ids_.push_back( std::this_thread::get_id() );
+    } ) );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  // Even if the other policies would hand their frames to a writer thread.
+  pgbar::config::writer_thread( true );
+
+  constexpr std::uint64_t num_tasks = 100;
+  const auto interval               = pgbar::config::refresh_interval<pgbar::Channel::Stdout>();
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::External> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ) };
+
+  // The first frame is written by the activation itself, and nothing follows until a poll.
+  for ( std::uint64_t i = 0; i < num_tasks / 2; ++i )
+    bar.tick();
+  PGBAR_CHECK( bar.active() );
+  const auto num_initial = writers->size();
+  PGBAR_CHECK( num_initial >= 1 );
+  std::this_thread::sleep_for( interval * 3 );
+  PGBAR_CHECK( writers->size() == num_initial );
+
+  // A poll renders a frame once the interval has passed, and tells how long until the next one.
+  const auto left = pgbar::poll<pgbar::Channel::Stdout>();
+  PGBAR_CHECK( writers->size() == num_initial + 1 );
+  PGBAR_CHECK( left > pgbar::TimeGranule::zero() && left <= interval );
+  PGBAR_CHECK( pgbar::poll<pgbar::Channel::Stdout>() <= interval );
+  PGBAR_CHECK( writers->size() == num_initial + 1 );
+
+  for ( std::uint64_t i = num_tasks / 2; i < num_tasks; ++i )
+    bar.tick();
+  PGBAR_CHECK( !bar.active() );
+  PGBAR_CHECK( pgbar::poll<pgbar::Channel::Stdout>() == ( pgbar::TimeGranule::max )() );
+
+  // Every frame came from this thread.
+  std::lock_guard<std::mutex> lock { writers->mtx_ };
+  for ( const auto& id : writers->ids_ )
+    PGBAR_CHECK( id == std::this_thread::get_id() );
+  return 0;
+}
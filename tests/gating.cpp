@@ -0,0 +1,80 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+// Return how many frames a synchronous bar with `style` writes for `num_tasks` ticks.
+std::uint64_t frames_of( std::uint8_t style, std::uint64_t num_tasks )
+{
+  auto capture = std::make_shared<pgbar::sink::CaptureSink>( 0 );
+  pgbar::config::sink<pgbar::Channel::Stderr>( capture );
+  pgbar::ProgressBar<pgbar::Channel::Stderr, pgbar::Policy::Sync> bar { pgbar::option::Style( style ),
+                                                                       pgbar::option::Tasks( num_tasks ) };
+  for ( std::uint64_t i = 0; i < num_tasks; ++i )
+    bar.tick();
+  PGBAR_CHECK( !bar.active() );
+  return capture->stats().frames_;
+}
+
+int main()
+{
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  pgbar::config::writer_thread( false );
+
+  // Every commit moves the percent meter, so the number of frames is the number of commits.
+  constexpr std::uint64_t num_tasks = 10000000;
+  const auto gated                  = frames_of( pgbar::config::Line::Per, num_tasks );
+  /**
+   * The percent meter has 10000 states, so a thousand ticks look the same;
+   * the stride is rounded down to a power of two, which commits at most twice as often.
+   */
+  PGBAR_CHECK( gated > 10000 / 2 );
+  PGBAR_CHECK( gated <= 10000 * 2 + 2 );
+  // The speed meter doesn't loosen the gate, however fast it changes.
+  const auto sped = frames_of( pgbar::config::Line::Per | pgbar::config::Line::Sped, num_tasks );
+  PGBAR_CHECK( sped <= 10000 * 2 + 2 );
+
+  // Once the counter is visible, every single tick matters again.
+  constexpr std::uint64_t num_counted = 10000;
+  const auto counted = frames_of( pgbar::config::Line::Cnt | pgbar::config::Line::Sped, num_counted );
+  PGBAR_CHECK( counted == num_counted + 1 );
+
+  {
+    // Nothing but the time bounds a time-driven frame, so it's still refreshed as the ticks come.
+    auto capture = std::make_shared<pgbar::sink::CaptureSink>( 0 );
+    pgbar::config::sink<pgbar::Channel::Stderr>( capture );
+    constexpr std::uint64_t num_slow = 100;
+    pgbar::ProgressBar<pgbar::Channel::Stderr, pgbar::Policy::Sync> bar {
+      pgbar::option::Style( pgbar::config::Line::Sped | pgbar::config::Line::Elpsd ),
+      pgbar::option::Tasks( num_slow ) };
+    for ( std::uint64_t i = 0; i < num_slow; ++i ) {
+      std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+      bar.tick();
+    }
+    // A tick every 10ms against the refresh interval of 40ms.
+    PGBAR_CHECK( capture->stats().frames_ >= num_slow / 4 / 2 );
+  }
+  {
+    // A revised configuration takes effect on the stride in the middle of a run.
+    auto capture = std::make_shared<pgbar::sink::CaptureSink>( 0 );
+    pgbar::config::sink<pgbar::Channel::Stderr>( capture );
+    constexpr std::uint64_t num_revised = 40000;
+    pgbar::ProgressBar<pgbar::Channel::Stderr, pgbar::Policy::Sync> bar {
+      pgbar::option::Style( pgbar::config::Line::Per ),
+      pgbar::option::Tasks( num_revised ) };
+    for ( std::uint64_t i = 0; i < num_revised / 2; ++i )
+      bar.tick();
+    const auto before = capture->stats().frames_;
+    PGBAR_CHECK( before <= num_revised / 2 / 2 );
+
+    bar.config().enable().counter();
+    for ( std::uint64_t i = num_revised / 2; i < num_revised; ++i )
+      bar.tick();
+    PGBAR_CHECK( !bar.active() );
+    PGBAR_CHECK( capture->stats().frames_ - before >= num_revised / 2 - 64 );
+  }
+  return 0;
+}
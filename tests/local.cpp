@@ -0,0 +1,56 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+int main()
+{
+  pgbar::config::sink<pgbar::Channel::Stdout>( std::make_shared<pgbar::sink::MemorySink>() );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+
+  {
+    // The ticks are held back until the batch is full, and the rest is published by the destructor.
+    pgbar::ProgressBar<pgbar::Channel::Stdout> bar { pgbar::option::Tasks( 100 ) };
+    {
+      auto ticker = bar.local_ticker( 10, pgbar::TimeGranule::zero() );
+      for ( int i = 0; i < 9; ++i )
+        ticker.tick();
+      PGBAR_CHECK( ticker.pending() == 9 && bar.progress() == 0 );
+      ticker.tick();
+      PGBAR_CHECK( ticker.pending() == 0 && bar.progress() == 10 );
+      for ( int i = 0; i < 5; ++i )
+        ticker.tick();
+      PGBAR_CHECK( bar.progress() == 10 );
+    }
+    PGBAR_CHECK( bar.progress() == 15 );
+    bar.reset();
+  }
+
+  // Each thread publishes a few full batches and a partial one, and the bar finishes exactly once.
+  constexpr std::uint64_t num_threads = 8, num_each = 1000, batch = 64;
+  pgbar::ProgressBar<pgbar::Channel::Stdout> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_threads * num_each ) };
+  std::atomic<int> num_finished { 0 };
+  bar.action( [&num_finished]() { num_finished.fetch_add( 1 ); } );
+
+  std::vector<std::thread> workers;
+  for ( std::uint64_t i = 0; i < num_threads; ++i )
+    workers.emplace_back( [&bar]() {
+      auto ticker = bar.local_ticker( batch );
+      for ( std::uint64_t j = 0; j < num_each; ++j ) {
+        ticker.tick();
+        PGBAR_CHECK( ticker.pending() < batch );
+      }
+    } );
+  for ( auto& worker : workers )
+    worker.join();
+  PGBAR_CHECK( bar.progress() == num_threads * num_each );
+  PGBAR_CHECK( !bar.active() );
+  PGBAR_CHECK( num_finished.load() == 1 );
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+// Tick a synchronous bar on `Stderr` through `num_tasks` tasks, sleeping `pause` after each one.
+void run( std::uint64_t num_tasks, std::chrono::milliseconds pause = std::chrono::milliseconds( 0 ) )
+{
+  pgbar::ProgressBar<pgbar::Channel::Stderr, pgbar::Policy::Sync> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ) };
+  for ( std::uint64_t i = 0; i < num_tasks; ++i ) {
+    bar.tick();
+    if ( pause.count() != 0 )
+      std::this_thread::sleep_for( pause );
+  }
+  PGBAR_CHECK( !bar.active() );
+}
+
+int main()
+{
+  pgbar::config::writer_thread( false );
+
+  {
+    // A line per milestone, besides the first frame and the last one.
+    auto memory = std::make_shared<pgbar::sink::MemorySink>();
+    pgbar::config::sink<pgbar::Channel::Stderr>( memory );
+    pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+    pgbar::config::log_milestone( 10 );
+    run( 100 );
+    std::string expected = " --.--% |   0/100\n";
+    for ( int percent = 10; percent < 100; percent += 10 )
+      expected += ' ' + std::to_string( percent ) + ".00% |  " + std::to_string( percent ) + "/100\n";
+    expected += "100.00% | 100/100\n";
+    PGBAR_CHECK( memory->str() == expected );
+  }
+  {
+    // With both limits off, every frame is written, as it is on a terminal.
+    auto capture = std::make_shared<pgbar::sink::CaptureSink>( 0 );
+    pgbar::config::sink<pgbar::Channel::Stderr>( capture );
+    pgbar::config::log_milestone( 0 );
+    run( 100 );
+    PGBAR_CHECK( capture->stats().frames_ == 100 + 1 );
+
+    auto terminal = std::make_shared<pgbar::sink::CaptureSink>( 0, true );
+    pgbar::config::sink<pgbar::Channel::Stderr>( terminal );
+    pgbar::config::log_milestone( 25 );
+    run( 100 );
+    PGBAR_CHECK( terminal->stats().frames_ == 100 + 1 );
+  }
+  {
+    // A line per interval, however many frames come in between.
+    constexpr std::uint64_t num_slow = 60;
+    const auto interval              = std::chrono::milliseconds( 50 );
+    auto capture                     = std::make_shared<pgbar::sink::CaptureSink>( 64 );
+    pgbar::config::sink<pgbar::Channel::Stderr>( capture );
+    pgbar::config::log_milestone( 0 );
+    pgbar::config::log_interval( interval );
+    run( num_slow, std::chrono::milliseconds( 5 ) );
+
+    const auto records = capture->records();
+    PGBAR_CHECK( records.size() >= 3 && records.size() < num_slow / 2 );
+    // The last frame carries the end of the task, so it isn't held back.
+    for ( std::size_t i = 1; i + 1 < records.size(); ++i )
+      PGBAR_CHECK( records[i].stamp_ - records[i - 1].stamp_ >= interval );
+
+    // The milestones add their own lines to those of the interval, even if the interval is long.
+    capture->reset();
+    pgbar::config::log_milestone( 25 );
+    pgbar::config::log_interval( std::chrono::seconds( 60 ) );
+    run( num_slow, std::chrono::milliseconds( 1 ) );
+    PGBAR_CHECK( capture->stats().frames_ == 1 + 3 + 1 );
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include "pgbar/Parallel.hpp"
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+// Drain a splitter from one thread, alternating the workers, and check each index is handed out once.
+void check_splitter()
+{
+  constexpr std::uint64_t total = 100;
+  pgbar::_details::concurrent::TaskSplitter splitter { 2, total, 10 };
+  std::vector<int> visits( total );
+  std::uint64_t num_stolen = 0;
+  // Worker 1 runs out of its half first, and then takes over the back of worker 0's half.
+  for ( std::uint64_t first, last; splitter.next( 1, first, last ); ) {
+    PGBAR_CHECK( first < last && last - first <= 10 );
+    for ( auto i = first; i < last; ++i )
+      ++visits[i];
+    num_stolen += first < total / 2;
+  }
+  for ( std::uint64_t first, last; splitter.next( 0, first, last ); )
+    for ( auto i = first; i < last; ++i )
+      ++visits[i];
+  for ( auto num : visits )
+    PGBAR_CHECK( num == 1 );
+  PGBAR_CHECK( num_stolen != 0 );
+}
+
+int main()
+{
+  check_splitter();
+
+  auto memory = std::make_shared<pgbar::sink::MemorySink>();
+  pgbar::config::sink<pgbar::Channel::Stdout>( memory );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+
+  constexpr std::uint64_t num_tasks = 4000, num_threads = 4;
+  pgbar::ProgressBar<pgbar::Channel::Stdout> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ) };
+  std::vector<std::atomic<int>> visits( num_tasks );
+  std::vector<std::thread::id> owners( num_tasks );
+  // Only the first interval is slow, so the other threads must steal from it to keep busy.
+  pgbar::parallel_for(
+    bar,
+    pgbar::slice::NumericSpan<std::uint64_t>( 0, num_tasks ),
+    [&]( std::uint64_t i ) {
+      if ( i < num_tasks / num_threads )
+        std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+      visits[i].fetch_add( 1, std::memory_order_relaxed );
+      owners[i] = std::this_thread::get_id();
+    },
+    num_threads );
+  PGBAR_CHECK( !bar.active() );
+
+  for ( const auto& num : visits )
+    PGBAR_CHECK( num.load() == 1 );
+  std::set<std::thread::id> slow_owners;
+  for ( std::uint64_t i = 0; i < num_tasks / num_threads; ++i )
+    slow_owners.insert( owners[i] );
+  PGBAR_CHECK( slow_owners.size() > 1 );
+  // Every chunk was ticked, so the bar reached the end.
+  PGBAR_CHECK( memory->str().find( "4000/4000" ) != std::string::npos );
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#if PGBAR__UNIX
+# include <unistd.h>
+#endif
+
+// Run the same bar synchronously to whatever the channel writes to now.
+void run()
+{
+  constexpr std::uint64_t num_tasks = 500;
+  // The static runs are long enough to be referenced rather than copied.
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Sync> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Ani | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ),
+    pgbar::option::Prefix( "Copying the files of the project over to the backup volume" ),
+    pgbar::option::Postfix( "and checking every one of them once it's there" ) };
+  for ( std::uint64_t i = 0; i < num_tasks; ++i )
+    bar.tick();
+  PGBAR_CHECK( !bar.active() );
+}
+
+int main()
+{
+#if PGBAR__UNIX
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  pgbar::config::writer_thread( false );
+
+  // Written by the calling thread straight to a file, each frame goes out by a single `writev`.
+  std::FILE* file = std::tmpfile();
+  PGBAR_CHECK( file != nullptr );
+  std::fflush( stdout );
+  const int saved = dup( STDOUT_FILENO );
+  PGBAR_CHECK( saved >= 0 && dup2( fileno( file ), STDOUT_FILENO ) >= 0 );
+  run();
+  PGBAR_CHECK( dup2( saved, STDOUT_FILENO ) >= 0 );
+  close( saved );
+
+  std::string scattered;
+  std::rewind( file );
+  for ( int ch; ( ch = std::fgetc( file ) ) != EOF; )
+    scattered.push_back( static_cast<char>( ch ) );
+  std::fclose( file );
+
+  // A sink takes each frame as a whole, so the frame is copied together before.
+  auto memory = std::make_shared<pgbar::sink::MemorySink>();
+  pgbar::config::sink<pgbar::Channel::Stdout>( memory );
+  run();
+  PGBAR_CHECK( !scattered.empty() );
+  PGBAR_CHECK( scattered == memory->str() );
+#endif
+  return 0;
+}
@@ -0,0 +1,35 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+int main()
+{
+  auto capture = std::make_shared<pgbar::sink::CaptureSink>( 0 );
+  pgbar::config::sink<pgbar::Channel::Stdout>( capture );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  // Requests within the interval are merged, but the frame they're merged into must still come out.
+  pgbar::config::signal_interval( std::chrono::milliseconds( 20 ) );
+
+  constexpr std::uint64_t num_tasks = 1000;
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Signal> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ) };
+  const auto start = std::chrono::steady_clock::now();
+  for ( std::uint64_t i = 0; i < num_tasks; ++i ) {
+    bar.tick();
+    std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+  }
+  PGBAR_CHECK( !bar.active() );
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  // About one frame per interval, give or take the slack of the scheduler.
+  const auto num_intervals = static_cast<std::uint64_t>( elapsed / std::chrono::milliseconds( 20 ) );
+  const auto num_frames    = capture->stats().frames_;
+  PGBAR_CHECK( num_frames >= num_intervals / 2 );
+  PGBAR_CHECK( num_frames <= num_intervals + 3 );
+  return 0;
+}
@@ -0,0 +1,67 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#if PGBAR__UNIX
+# include <unistd.h>
+#endif
+
+// Run the same synchronous bar on `Outlet`.
+template<pgbar::Channel Outlet>
+void run( std::uint64_t num_tasks )
+{
+  pgbar::ProgressBar<Outlet, pgbar::Policy::Sync> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ) };
+  for ( std::uint64_t i = 0; i < num_tasks; ++i )
+    bar.tick();
+  PGBAR_CHECK( !bar.active() );
+}
+
+int main()
+{
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+
+  // The callback receives every frame as it is, and nothing else.
+  constexpr std::uint64_t num_tasks = 2000;
+  auto received                     = std::make_shared<std::string>();
+  pgbar::config::sink<pgbar::Channel::Stderr>( std::make_shared<pgbar::sink::CallbackSink>(
+    [received]( const char* data, std::size_t size ) { received->append( data, size ); } ) );
+  run<pgbar::Channel::Stderr>( num_tasks );
+  const std::string first = " --.--% |    0/2000\n", last = "100.00% | 2000/2000\n";
+  PGBAR_CHECK( received->size() > first.size() + last.size() );
+  PGBAR_CHECK( received->compare( 0, first.size(), first ) == 0 );
+  PGBAR_CHECK( received->compare( received->size() - last.size(), last.size(), last ) == 0 );
+  // The counter is visible, so every tick has its own line.
+  PGBAR_CHECK( static_cast<std::uint64_t>( std::count( received->cbegin(), received->cend(), '\n' ) )
+               == num_tasks + 1 );
+
+#if PGBAR__UNIX
+  // The same bytes come out of a pipe, which is drained while the bar is still writing;
+  // none of the frames are dropped for a pipe that lags, unless the backpressure is enabled.
+  int fds[2];
+  PGBAR_CHECK( pipe( fds ) == 0 );
+  std::string piped;
+  std::thread reader { [&piped, &fds]() {
+    char buffer[4096];
+    for ( ssize_t num; ( num = read( fds[0], buffer, sizeof( buffer ) ) ) > 0; )
+      piped.append( buffer, static_cast<std::size_t>( num ) );
+  } };
+  auto fd_sink = std::make_shared<pgbar::sink::FdSink>( fds[1] );
+  PGBAR_CHECK( !fd_sink->tty() && fd_sink->fd() == fds[1] );
+  pgbar::config::sink<pgbar::Channel::Stdout>( fd_sink );
+  run<pgbar::Channel::Stdout>( num_tasks );
+  // The writer thread has written everything once the bar has stopped.
+  pgbar::config::sink<pgbar::Channel::Stdout>( nullptr );
+  fd_sink.reset();
+  close( fds[1] );
+  reader.join();
+  close( fds[0] );
+  PGBAR_CHECK( piped == *received );
+#endif
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Tick an asynchronous bar for `duration` into a terminal sink that takes `write_cost` per frame,
+ * and return the median gap between the frames written in the second half of the run.
+ */
+Clock::duration median_gap( Clock::duration write_cost, Clock::duration duration )
+{
+  // Shared with the callback, which may still be running on the writer thread when the bar is gone.
+  struct Record {
+    Clock::duration write_cost_;
+    std::mutex mtx_;
+    std::vector<Clock::time_point> stamps_;
+  };
+  auto record         = std::make_shared<Record>();
+  record->write_cost_ = write_cost;
+  pgbar::config::sink<pgbar::Channel::Stdout>( std::make_shared<pgbar::sink::CallbackSink>(
+    [record]( const char*, std::size_t ) {
+      std::this_thread::sleep_for( record->write_cost_ );
+      std::lock_guard<std::mutex> lock { record->mtx_ };
+      record->stamps_.push_back( Clock::now() );
+    },
+    true ) );
+  {
+    pgbar::ProgressBar<pgbar::Channel::Stdout> bar { pgbar::option::Tasks( 1000000 ) };
+    for ( const auto deadline = Clock::now() + duration; Clock::now() < deadline; ) {
+      bar.tick();
+      std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+    }
+    bar.reset();
+  }
+  std::lock_guard<std::mutex> lock { record->mtx_ };
+  const auto& stamps = record->stamps_;
+  PGBAR_CHECK( stamps.size() > 4 );
+  std::vector<Clock::duration> gaps;
+  for ( auto i = stamps.size() / 2; i < stamps.size(); ++i )
+    gaps.push_back( stamps[i] - stamps[i - 1] );
+  std::nth_element( gaps.begin(), gaps.begin() + gaps.size() / 2, gaps.end() );
+  return gaps[gaps.size() / 2];
+}
+
+int main()
+{
+  pgbar::config::refresh_interval<pgbar::Channel::Stdout>( std::chrono::milliseconds( 40 ) );
+
+  constexpr auto write_cost = std::chrono::milliseconds( 50 );
+  // Without the adaptation, the frames are written back to back, as fast as the sink takes them.
+  const auto fixed = median_gap( write_cost, std::chrono::milliseconds( 800 ) );
+  PGBAR_CHECK( fixed < write_cost * 3 / 2 );
+
+  pgbar::config::refresh_bounds<pgbar::Channel::Stdout>( pgbar::TimeGranule::zero(),
+                                                         std::chrono::seconds( 2 ) );
+  const auto fast = median_gap( Clock::duration::zero(), std::chrono::milliseconds( 800 ) );
+  const auto slow = median_gap( write_cost, std::chrono::milliseconds( 1600 ) );
+  // A cheap sink is served at the configured interval.
+  PGBAR_CHECK( fast < write_cost );
+  // A slow one stretches the interval, so that the sink stays idle for about half of the time.
+  PGBAR_CHECK( slow >= write_cost * 3 / 2 );
+  return 0;
+}
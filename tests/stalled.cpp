@@ -0,0 +1,60 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+// A reader that takes nothing until it's released.
+struct Reader {
+  std::atomic<bool> released_ { false };
+  std::mutex mtx_;
+  std::vector<std::string> frames_;
+};
+
+int main()
+{
+  auto reader = std::make_shared<Reader>();
+  pgbar::config::sink<pgbar::Channel::Stdout>(
+    std::make_shared<pgbar::sink::CallbackSink>( [reader]( const char* data, std::size_t size ) {
+      while ( !reader->released_.load( std::memory_order_acquire ) )
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+      std::lock_guard<std::mutex> lock { reader->mtx_ };
+      reader->frames_.emplace_back( data, size );
+    } ) );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  pgbar::config::writer_thread( true );
+  pgbar::config::backpressure<pgbar::Channel::Stdout>( true );
+
+  constexpr std::uint64_t num_tasks = 20000;
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Sync> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ) };
+  // Every tick renders a frame, while the writer thread is stuck with the first one.
+  Clock::duration slowest {};
+  for ( std::uint64_t i = 0; i + 1 < num_tasks; ++i ) {
+    const auto start = Clock::now();
+    bar.tick();
+    slowest = ( std::max )( slowest, Clock::now() - start );
+  }
+  PGBAR_CHECK( slowest < std::chrono::milliseconds( 100 ) );
+  PGBAR_CHECK( bar.active() );
+
+  reader->released_.store( true, std::memory_order_release );
+  bar.tick();
+  PGBAR_CHECK( !bar.active() );
+
+  std::lock_guard<std::mutex> lock { reader->mtx_ };
+  const auto& frames = reader->frames_;
+  // The frames held back replaced each other, and the last one is never dropped.
+  PGBAR_CHECK( !frames.empty() && frames.size() < num_tasks / 10 );
+  PGBAR_CHECK( frames.back().find( "20000/20000" ) != std::string::npos );
+  return 0;
+}
@@ -0,0 +1,45 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <memory>
+#include <string>
+
+int main()
+{
+  auto memory = std::make_shared<pgbar::sink::MemorySink>();
+  pgbar::config::sink<pgbar::Channel::Stdout>( memory );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  pgbar::config::writer_thread( false );
+
+  using Bar = pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Sync>;
+  Bar bar { pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Ani
+                                  | pgbar::config::Line::Cnt ),
+            pgbar::option::Tasks( 4 ),
+            pgbar::option::Prefix( "Job" ),
+            pgbar::option::Postfix( "done?" ) };
+  bar.tick();
+  bar.tick();
+  // Both the static bytes and the slots change, so the template has to be compiled again.
+  bar.config().prefix( "Task" ).disable().counter();
+  bar.tick();
+  bar.tick();
+  PGBAR_CHECK( !bar.active() );
+  PGBAR_CHECK( memory->take()
+               == "Job  --.--% | [>                             ] | 0/4 done?\n"
+                  "Job  25.00% | [========>                     ] | 1/4 done?\n"
+                  "Job  50.00% | [===============>              ] | 2/4 done?\n"
+                  "Task  75.00% | [=======================>      ] done?\n"
+                  "Task 100.00% | [==============================] done?\n" );
+
+  // A copy of the configuration compiles its own template.
+  Bar copy { bar.config() };
+  copy.config().tasks( 2 );
+  copy.tick();
+  copy.tick();
+  PGBAR_CHECK( !copy.active() );
+  PGBAR_CHECK( memory->take()
+               == "Task  --.--% | [>                             ] done?\n"
+                  "Task  50.00% | [===============>              ] done?\n"
+                  "Task 100.00% | [==============================] done?\n" );
+  return 0;
+}
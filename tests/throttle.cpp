@@ -0,0 +1,42 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+int main()
+{
+  auto capture = std::make_shared<pgbar::sink::CaptureSink>( 0 );
+  pgbar::config::sink<pgbar::Channel::Stdout>( capture );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+  pgbar::config::writer_thread( false );
+
+  // Every tick is visible, so each thread keeps asking for a frame.
+  constexpr std::uint64_t num_threads = 4, num_each = 200;
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Throttle> bar {
+    pgbar::option::Style( pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_threads * num_each ) };
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for ( std::uint64_t i = 0; i < num_threads; ++i )
+    workers.emplace_back( [&bar]() {
+      for ( std::uint64_t j = 0; j < num_each; ++j ) {
+        bar.tick();
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+      }
+    } );
+  for ( auto& worker : workers )
+    worker.join();
+  PGBAR_CHECK( !bar.active() );
+
+  // Whichever thread asks, at most one frame is written per interval, besides the first and the last.
+  const auto elapsed  = std::chrono::steady_clock::now() - start;
+  const auto interval = pgbar::config::refresh_interval<pgbar::Channel::Stdout>();
+  const auto frames   = capture->stats().frames_;
+  PGBAR_CHECK( frames > 2 );
+  PGBAR_CHECK( frames <= static_cast<std::uint64_t>( elapsed / interval ) + 3 );
+  return 0;
+}
@@ -0,0 +1,51 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+int main()
+{
+  pgbar::config::sink<pgbar::Channel::Stdout>( std::make_shared<pgbar::sink::MemorySink>() );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+
+  // Enough tasks for the counter to be striped on a machine with several cores.
+  constexpr std::uint64_t num_threads = 8, num_each = 1 << 16, num_tasks = num_threads * num_each;
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Async> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ) };
+  bar.start();
+  PGBAR_CHECK( bar.active() );
+
+  // The progress never goes back, and the bar stops only once every task is done.
+  std::atomic<bool> done { false };
+  std::thread observer { [&]() {
+    std::uint64_t last = 0;
+    do {
+      const bool active   = bar.active();
+      const auto progress = bar.progress();
+      PGBAR_CHECK( progress >= last && progress <= num_tasks );
+      PGBAR_CHECK( active || progress == num_tasks );
+      last = progress;
+    } while ( !done.load( std::memory_order_acquire ) );
+  } };
+
+  std::vector<std::thread> workers;
+  for ( std::uint64_t i = 0; i < num_threads; ++i )
+    workers.emplace_back( [&bar]() {
+      for ( std::uint64_t j = 0; j < num_each; ++j )
+        bar.tick();
+    } );
+  for ( auto& worker : workers )
+    worker.join();
+  // The last tick has stopped the bar before it returned.
+  PGBAR_CHECK( !bar.active() );
+  PGBAR_CHECK( bar.progress() == num_tasks );
+
+  done.store( true, std::memory_order_release );
+  observer.join();
+  return 0;
+}
@@ -0,0 +1,60 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+int main()
+{
+  pgbar::config::sink<pgbar::Channel::Stdout>( std::make_shared<pgbar::sink::MemorySink>() );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+
+  constexpr std::uint64_t num_tasks = 100;
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Sync> bar {
+    pgbar::option::Style( pgbar::config::Line::Per | pgbar::config::Line::Cnt ),
+    pgbar::option::Tasks( num_tasks ) };
+  std::atomic<int> num_finished { 0 };
+  bar.action( [&num_finished]() { num_finished.fetch_add( 1 ); } );
+
+  // A second `start()` on an active bar changes nothing.
+  bar.start();
+  PGBAR_CHECK( bar.active() );
+  for ( std::uint64_t i = 0; i < num_tasks - 1; ++i )
+    bar.tick_unchecked();
+  bar.start();
+  PGBAR_CHECK( bar.active() && bar.progress() == num_tasks - 1 );
+
+  // A step that overshoots is clamped to the number of tasks, and finishes the bar.
+  bar.tick_unchecked( 5 );
+  PGBAR_CHECK( !bar.active() );
+  PGBAR_CHECK( bar.progress() == num_tasks );
+  PGBAR_CHECK( num_finished.load() == 1 );
+
+  // Once finished, `start()` begins a new round from zero.
+  bar.start();
+  PGBAR_CHECK( bar.active() && bar.progress() == 0 );
+  bar.tick_unchecked( num_tasks * 2 );
+  PGBAR_CHECK( !bar.active() && bar.progress() == num_tasks );
+  PGBAR_CHECK( num_finished.load() == 2 );
+
+  // A thread's tick may still be rendering while another one finishes the bar.
+  constexpr std::uint64_t num_threads = 4, num_rounds = 50;
+  for ( std::uint64_t round = 0; round < num_rounds; ++round ) {
+    bar.start();
+    std::vector<std::thread> workers;
+    for ( std::uint64_t i = 0; i < num_threads; ++i )
+      workers.emplace_back( [&bar]() {
+        for ( std::uint64_t j = 0; j < num_tasks / num_threads; ++j )
+          bar.tick_unchecked();
+      } );
+    for ( auto& worker : workers )
+      worker.join();
+    PGBAR_CHECK( !bar.active() );
+    PGBAR_CHECK( bar.progress() == num_tasks );
+  }
+  PGBAR_CHECK( num_finished.load() == 2 + num_rounds );
+  return 0;
+}
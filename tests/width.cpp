@@ -0,0 +1,99 @@
+#include "pgbar/ProgressBar.hpp"
+#include "Check.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+# include <signal.h>
+#endif
+
+// A terminal whose width can be changed while the bar is running.
+class Terminal final : public pgbar::sink::Sink {
+  std::string bytes_;
+  mutable std::mutex mtx_;
+
+public:
+  std::atomic<std::uint16_t> width_ { 0 };
+
+  void write( const char* data, std::size_t size ) override
+  {
+    std::lock_guard<std::mutex> lock { mtx_ };
+    bytes_.append( data, size );
+  }
+  bool tty() const noexcept override { return true; }
+  std::uint16_t width() const noexcept override { return width_.load(); }
+
+  // Take the lines written so far, stripped of the control sequences.
+  std::vector<std::string> take()
+  {
+    std::lock_guard<std::mutex> lock { mtx_ };
+    std::vector<std::string> lines { std::string() };
+    for ( std::size_t pos = 0; pos < bytes_.size(); ++pos ) {
+      if ( bytes_[pos] == '\x1B' ) {
+        while ( ++pos < bytes_.size()
+                && !( bytes_[pos] >= '@' && bytes_[pos] <= '~' && bytes_[pos] != '[' ) ) {}
+        // Saving or restoring the cursor starts the frame over.
+        if ( pos < bytes_.size() && ( bytes_[pos] == 's' || bytes_[pos] == 'u' ) )
+          lines.emplace_back();
+      } else if ( bytes_[pos] == '\n' || bytes_[pos] == '\r' )
+        lines.emplace_back();
+      else
+        lines.back() += bytes_[pos];
+    }
+    bytes_.clear();
+    return lines;
+  }
+};
+
+int main()
+{
+  auto terminal = std::make_shared<Terminal>();
+  pgbar::config::sink<pgbar::Channel::Stdout>( terminal );
+  pgbar::config::writer_thread( false );
+  pgbar::config::damage_tracking( false );
+  pgbar::config::log_interval( pgbar::TimeGranule::zero() );
+  pgbar::config::log_milestone( 0 );
+
+  constexpr std::uint64_t num_tasks = 30;
+  const std::string postfix         = "and a rather long postfix";
+  pgbar::ProgressBar<pgbar::Channel::Stdout, pgbar::Policy::Sync> bar { pgbar::option::Tasks( num_tasks ),
+                                                                       pgbar::option::Prefix( "prefix" ),
+                                                                       pgbar::option::Postfix( postfix ) };
+  // A narrow terminal makes the bar indicator and the postfix give way.
+  terminal->width_ = 90;
+  for ( std::uint64_t i = 0; i < num_tasks / 3; ++i )
+    bar.tick();
+  std::size_t num_narrow = 0;
+  for ( const auto& line : terminal->take() ) {
+    PGBAR_CHECK( line.size() <= 90 );
+    PGBAR_CHECK( line.find( postfix ) == std::string::npos );
+    num_narrow += line.find( "prefix" ) != std::string::npos;
+  }
+  PGBAR_CHECK( num_narrow >= num_tasks / 3 );
+
+  // The sink is asked again on every frame, so the line grows back at once.
+  terminal->width_ = 200;
+  for ( std::uint64_t i = num_tasks / 3; i < num_tasks; ++i )
+    bar.tick();
+  PGBAR_CHECK( !bar.active() );
+  std::size_t num_whole = 0;
+  for ( const auto& line : terminal->take() ) {
+    PGBAR_CHECK( line.size() <= 200 );
+    num_whole += line.find( postfix ) != std::string::npos;
+  }
+  PGBAR_CHECK( num_whole >= num_tasks / 3 );
+
+#if PGBAR__UNIX && !defined( PGBAR_NOWINCH )
+  // Nothing is installed for `SIGWINCH` unless it's asked for, and the previous handler comes back after.
+  struct sigaction action {};
+  PGBAR_CHECK( sigaction( SIGWINCH, nullptr, &action ) == 0 && action.sa_handler == SIG_DFL );
+  pgbar::config::track_resize( true );
+  PGBAR_CHECK( pgbar::config::track_resize<pgbar::Channel::Stdout>() );
+  PGBAR_CHECK( sigaction( SIGWINCH, nullptr, &action ) == 0 && ( action.sa_flags & SA_SIGINFO ) );
+  pgbar::config::track_resize( false );
+  PGBAR_CHECK( sigaction( SIGWINCH, nullptr, &action ) == 0 && action.sa_handler == SIG_DFL );
+#endif
+  return 0;
+}